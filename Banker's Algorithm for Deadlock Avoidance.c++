@@ -1,7 +1,8 @@
 // bankers_algorithm.cpp
 #include <iostream>
 #include <vector>
-#include <numeric> // For std::accumulate, std::all_of
+#include <numeric> // For std::accumulate, std::all_of, std::iota
+#include <algorithm> // For std::sort, std::copy, std::fill
 
 // Function to check if the system is in a safe state
 bool isSafe(int num_processes, int num_resources,
@@ -135,6 +136,300 @@ bool requestResources(int process_id, const std::vector<int>& request,
 }
 
 
+
+// ---------------------------------------------------------------------------
+// High-throughput Banker's engine
+// ---------------------------------------------------------------------------
+// Same safety rules as isSafe/requestResources, built for many processes and
+// many resource types:
+//   - Allocation, Max and Need are flat row-major arrays (process-major).
+//   - Need is updated in place on every grant, never rebuilt.
+//   - A request is tried directly on the live state and rolled back if unsafe,
+//     so nothing is copied.
+//   - For each resource type the processes are kept sorted by Need. The safety
+//     check then only visits the processes a rise in Work can unblock: each
+//     resource has a cursor over its sorted list, and a process becomes runnable
+//     once every cursor has passed it. One check is O(n * m).
+//   - Once the state is known to be safe, a grant to P only has to show that P
+//     itself can still finish: P returns everything it was just given, so from
+//     there the old safe sequence completes the rest. The check stops as soon as
+//     P finishes, and is skipped entirely when P's Need already fits Available.
+//   - Row comparisons (request <= need, request <= available) are branch-free
+//     loops the compiler can vectorize.
+
+enum class RequestStatus {
+    Granted,        // Allocated; the system remains safe
+    ExceedsClaim,   // Request > Need (an error by the process)
+    MustWait,       // Request > Available
+    Unsafe,         // Granting would leave no safe sequence
+    Invalid         // Unknown process, wrong number of amounts, or a negative amount
+};
+
+const char* requestStatusName(RequestStatus status) {
+    switch (status) {
+        case RequestStatus::Granted:      return "Granted";
+        case RequestStatus::ExceedsClaim: return "Exceeds maximum claim";
+        case RequestStatus::MustWait:     return "Must wait (resources not available)";
+        case RequestStatus::Unsafe:       return "Denied (unsafe state)";
+        case RequestStatus::Invalid:      return "Invalid request";
+    }
+    return "?";
+}
+
+struct ResourceRequest {
+    int process_id;
+    std::vector<int> amounts; // One entry per resource type
+};
+
+// True if a[j] <= b[j] for every j. No early exit, so the loop vectorizes.
+inline bool rowFits(const int* a, const int* b, int m) {
+    int exceeded = 0;
+    for (int j = 0; j < m; ++j) exceeded |= (a[j] > b[j]);
+    return exceeded == 0;
+}
+
+class BankersEngine {
+public:
+    BankersEngine(const std::vector<int>& available,
+                  const std::vector<std::vector<int>>& max_need,
+                  const std::vector<std::vector<int>>& allocation)
+        : n_(max_need.size()), m_(available.size()), available_(available)
+    {
+        if ((int)allocation.size() != n_) {
+            std::cerr << "Error: Allocation and Max Need have different process counts" << std::endl;
+            valid_ = false;
+            return;
+        }
+        for (int j = 0; j < m_; ++j) {
+            if (available_[j] < 0) {
+                std::cerr << "Error: Available count for R" << j << " is negative" << std::endl;
+                valid_ = false;
+                return;
+            }
+        }
+        allocation_.resize((size_t)n_ * m_);
+        need_.resize((size_t)n_ * m_);
+        for (int i = 0; i < n_; ++i) {
+            if ((int)max_need[i].size() != m_ || (int)allocation[i].size() != m_) {
+                std::cerr << "Error: Row for P" << i << " does not have " << m_ << " resource types" << std::endl;
+                valid_ = false;
+                return;
+            }
+            for (int j = 0; j < m_; ++j) {
+                if (allocation[i][j] < 0) {
+                    std::cerr << "Error: Negative allocation for P" << i << ", R" << j << std::endl;
+                    valid_ = false;
+                    return;
+                }
+                allocation_[idx(i, j)] = allocation[i][j];
+                need_[idx(i, j)] = max_need[i][j] - allocation[i][j];
+                if (need_[idx(i, j)] < 0) {
+                    std::cerr << "Error: Allocation exceeds max need for P" << i << ", R" << j << std::endl;
+                    valid_ = false;
+                    return;
+                }
+            }
+        }
+
+        // Per-resource process order by Need, each process's rank in it, and the
+        // Need values in that order (so the safety check scans memory sequentially)
+        order_.resize((size_t)m_ * n_);
+        rank_.resize((size_t)m_ * n_);
+        sorted_need_.resize((size_t)m_ * n_);
+        for (int j = 0; j < m_; ++j) {
+            int* ord = &order_[(size_t)j * n_];
+            std::iota(ord, ord + n_, 0);
+            std::sort(ord, ord + n_, [&](int a, int b) { return need_[idx(a, j)] < need_[idx(b, j)]; });
+            for (int k = 0; k < n_; ++k) {
+                rank_[(size_t)j * n_ + ord[k]] = k;
+                sorted_need_[(size_t)j * n_ + k] = need_[idx(ord[k], j)];
+            }
+        }
+
+        work_.resize(m_);
+        cursor_.resize(m_);
+        blocked_.resize(n_);
+        worklist_.reserve(n_);
+    }
+
+    bool valid() const { return valid_; }
+    int numProcesses() const { return n_; }
+    int numResources() const { return m_; }
+    const std::vector<int>& available() const { return available_; }
+    int allocation(int i, int j) const { return allocation_[idx(i, j)]; }
+    int need(int i, int j) const { return need_[idx(i, j)]; }
+
+    // Safety check on the current state. If safe_sequence is given it receives a
+    // safe order (any valid order; it may differ from isSafe's). Always false
+    // for an engine whose constructor rejected its input.
+    bool isSafe(std::vector<int>* safe_sequence = nullptr) {
+        if (safe_sequence) safe_sequence->clear();
+        if (!valid_) return false;
+        known_safe_ = checkSafe(-1, safe_sequence);
+        return known_safe_;
+    }
+
+    // Banker's request algorithm: check the claim and availability, grant
+    // tentatively, keep it if the result is safe, otherwise roll it back.
+    // `request` must point to numResources() amounts.
+    RequestStatus requestResources(int process_id, const int* request) {
+        if (!validInput(process_id, request)) return RequestStatus::Invalid;
+        if (!rowFits(request, &need_[idx(process_id, 0)], m_)) return RequestStatus::ExceedsClaim;
+        if (!rowFits(request, available_.data(), m_)) return RequestStatus::MustWait;
+
+        apply(process_id, request, 1);
+        bool safe;
+        if (known_safe_) {
+            safe = rowFits(&need_[idx(process_id, 0)], available_.data(), m_) || checkSafe(process_id, nullptr);
+        } else {
+            safe = checkSafe(-1, nullptr);
+        }
+        if (safe) {
+            known_safe_ = true;
+            return RequestStatus::Granted;
+        }
+        apply(process_id, request, -1); // Roll back
+        return RequestStatus::Unsafe;
+    }
+
+    RequestStatus requestResources(int process_id, const std::vector<int>& request) {
+        if ((int)request.size() != m_) return RequestStatus::Invalid;
+        return requestResources(process_id, request.data());
+    }
+
+    // Returns resources a process no longer needs (this never makes a safe state
+    // unsafe). Returns false (and changes nothing) if the input is invalid or it
+    // would release more than the process holds.
+    bool releaseResources(int process_id, const std::vector<int>& amounts) {
+        if ((int)amounts.size() != m_ || !validInput(process_id, amounts.data())) return false;
+        if (!rowFits(amounts.data(), &allocation_[idx(process_id, 0)], m_)) return false;
+        apply(process_id, amounts.data(), -1);
+        return true;
+    }
+
+    // Evaluates pending requests in order against the evolving state, reusing
+    // the engine's scratch buffers for every check.
+    std::vector<RequestStatus> requestBatch(const std::vector<ResourceRequest>& requests) {
+        std::vector<RequestStatus> results;
+        results.reserve(requests.size());
+        for (const auto& r : requests) results.push_back(requestResources(r.process_id, r.amounts));
+        return results;
+    }
+
+private:
+    size_t idx(int i, int j) const { return (size_t)i * m_ + j; }
+
+    // Engine constructed successfully, process id in range, no negative amounts
+    bool validInput(int process_id, const int* amounts) const {
+        if (!valid_ || process_id < 0 || process_id >= n_) return false;
+        int negative = 0;
+        for (int j = 0; j < m_; ++j) negative |= (amounts[j] < 0);
+        return negative == 0;
+    }
+
+    // Worklist-driven safety check. With stop_after >= 0 it returns true as soon
+    // as that process can finish (only valid when the state before the last grant
+    // to it was safe).
+    bool checkSafe(int stop_after, std::vector<int>* safe_sequence) {
+        std::copy(available_.begin(), available_.end(), work_.begin());
+        std::fill(blocked_.begin(), blocked_.end(), m_);
+        std::fill(cursor_.begin(), cursor_.end(), 0);
+        worklist_.clear();
+        if (safe_sequence) safe_sequence->clear();
+
+        for (int j = 0; j < m_; ++j) advance(j);
+        if (m_ == 0) {
+            for (int i = 0; i < n_; ++i) worklist_.push_back(i);
+        }
+
+        int finished = 0;
+        while (!worklist_.empty()) {
+            int p = worklist_.back();
+            worklist_.pop_back();
+            finished++;
+            if (safe_sequence) safe_sequence->push_back(p);
+            if (p == stop_after) return true;
+
+            // Process p runs to completion and returns its allocation
+            const int* alloc = &allocation_[idx(p, 0)];
+            for (int j = 0; j < m_; ++j) work_[j] += alloc[j];
+            for (int j = 0; j < m_; ++j) {
+                if (alloc[j] > 0) advance(j);
+            }
+        }
+        if (finished < n_ && safe_sequence) safe_sequence->clear();
+        return finished == n_;
+    }
+
+    // Moves past every process whose Need for resource j now fits in Work[j];
+    // a process that has passed all m cursors joins the worklist.
+    void advance(int j) {
+        const int* ord = &order_[(size_t)j * n_];
+        const int* sorted = &sorted_need_[(size_t)j * n_];
+        int k = cursor_[j];
+        while (k < n_ && sorted[k] <= work_[j]) {
+            if (--blocked_[ord[k]] == 0) worklist_.push_back(ord[k]);
+            k++;
+        }
+        cursor_[j] = k;
+    }
+
+    // Allocates (sign = 1) or returns (sign = -1) `amounts` for one process,
+    // updating Need in place and re-sorting only the resources that changed.
+    void apply(int process_id, const int* amounts, int sign) {
+        int* alloc = &allocation_[idx(process_id, 0)];
+        int* need = &need_[idx(process_id, 0)];
+        for (int j = 0; j < m_; ++j) {
+            available_[j] -= sign * amounts[j];
+            alloc[j] += sign * amounts[j];
+            need[j] -= sign * amounts[j];
+        }
+        for (int j = 0; j < m_; ++j) {
+            if (amounts[j] != 0) reposition(process_id, j);
+        }
+    }
+
+    // Restores process p's place in resource j's Need order after its Need changed
+    void reposition(int p, int j) {
+        int* ord = &order_[(size_t)j * n_];
+        int* rank = &rank_[(size_t)j * n_];
+        int* sorted = &sorted_need_[(size_t)j * n_];
+        int value = need_[idx(p, j)];
+        int k = rank[p];
+        while (k > 0 && sorted[k - 1] > value) {
+            ord[k] = ord[k - 1];
+            sorted[k] = sorted[k - 1];
+            rank[ord[k]] = k;
+            k--;
+        }
+        while (k < n_ - 1 && sorted[k + 1] < value) {
+            ord[k] = ord[k + 1];
+            sorted[k] = sorted[k + 1];
+            rank[ord[k]] = k;
+            k++;
+        }
+        ord[k] = p;
+        sorted[k] = value;
+        rank[p] = k;
+    }
+
+    int n_;
+    int m_;
+    bool valid_ = true;
+    bool known_safe_ = false; // Current state has passed a full safety check
+    std::vector<int> available_;
+    std::vector<int> allocation_;
+    std::vector<int> need_;
+    std::vector<int> order_;  // m rows of n process ids, each sorted by Need[.][j]
+    std::vector<int> rank_;   // m rows: rank_[j][p] = position of p in order_[j]
+    std::vector<int> sorted_need_; // m rows: Need[order_[j][k]][j]
+    // Scratch space for isSafe, allocated once
+    std::vector<int> work_;
+    std::vector<int> cursor_;
+    std::vector<int> blocked_; // Resources for which a process still needs more than Work
+    std::vector<int> worklist_;
+};
+
 int main() {
     // Example from Silberschatz, Galvin, Gagne OS Concepts book
     const int P = 5; // Number of processes
@@ -179,6 +474,9 @@ int main() {
         // or the system needs correction.
     }
 
+    // Engine below starts from the same initial state
+    BankersEngine engine(available, max_need, allocation);
+
     // --- Simulate some requests ---
 
     // Request 1: P1 requests (1, 0, 2)
@@ -193,5 +491,22 @@ int main() {
      std::vector<int> req3 = {0, 2, 0};
     requestResources(0, req3, P, R, available, max_need, allocation);
 
+    // --- Same requests through the flat, incremental engine in one batch ---
+    if (!engine.valid()) return 1;
+    std::vector<ResourceRequest> batch = {{1, req1}, {4, req2}, {0, req3}};
+    std::cout << "\n--- Banker's Engine (batch of " << batch.size() << " requests) ---" << std::endl;
+    std::vector<RequestStatus> statuses = engine.requestBatch(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std::cout << "> P" << batch[i].process_id << " requests: ";
+        for (int r : batch[i].amounts) std::cout << r << " ";
+        std::cout << "-> " << requestStatusName(statuses[i]) << std::endl;
+    }
+    std::vector<int> engine_sequence;
+    if (engine.isSafe(&engine_sequence)) {
+        std::cout << "Final state is SAFE. Safe sequence: ";
+        for (size_t i = 0; i < engine_sequence.size(); ++i) std::cout << "P" << engine_sequence[i] << (i == engine_sequence.size() - 1 ? "" : " -> ");
+        std::cout << std::endl;
+    }
+
     return 0;
 }
@@ -6,6 +6,11 @@
 #include <chrono>
 #include <random>
 #include <string>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <cstdlib>
 
 const int NUM_PHILOSOPHERS = 5;
 
@@ -74,7 +79,257 @@ void philosopher(int id) {
     }
 }
 
-int main() {
+// --- Benchmark Mode (--bench) ---
+// The demo above sleeps and prints while holding chopsticks, so it says nothing
+// about the cost of the locking itself. Benchmark mode drops both: every
+// philosopher loops hungry -> eat -> think for a fixed duration and records how
+// long it waited for its chopsticks and how long it held them. The table compares
+// three ways of picking the chopsticks up at 2..N philosophers.
+
+// Log2-bucketed latency histogram (nanoseconds), one per philosopher
+struct WaitHistogram {
+    static const int BUCKETS = 48;
+    long long counts[BUCKETS] = {};
+    long long total = 0;
+    long long sum_ns = 0;
+    long long max_ns = 0;
+
+    void record(long long ns) {
+        int b = 0;
+        while (b < BUCKETS - 1 && (1LL << b) <= ns) b++;
+        counts[b]++;
+        total++;
+        sum_ns += ns;
+        if (ns > max_ns) max_ns = ns;
+    }
+
+    void merge(const WaitHistogram& other) {
+        for (int b = 0; b < BUCKETS; ++b) counts[b] += other.counts[b];
+        total += other.total;
+        sum_ns += other.sum_ns;
+        if (other.max_ns > max_ns) max_ns = other.max_ns;
+    }
+
+    long long percentile(double q) const {
+        if (total == 0) return 0;
+        long long target = (long long)(q * (total - 1)) + 1;
+        long long seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += counts[b];
+            if (seen >= target) return b == 0 ? 0 : (1LL << b);
+        }
+        return max_ns;
+    }
+
+    double mean() const { return total > 0 ? (double)sum_ns / total : 0; }
+};
+
+struct alignas(64) PhilosopherStats {
+    WaitHistogram wait;  // Hungry until holding both chopsticks
+    WaitHistogram hold;  // Time spent eating
+    long long meals = 0;
+};
+
+// Baseline: the asymmetric std::lock scheme used by philosopher() above
+struct StdLockTable {
+    static const char* name() { return "std_lock"; }
+    std::vector<std::mutex> sticks;
+    int n;
+    explicit StdLockTable(int count) : sticks(count), n(count) {}
+    void pickUp(int id) {
+        int left = id, right = (id + 1) % n;
+        if (id == n - 1) std::swap(left, right);
+        std::lock(sticks[left], sticks[right]);
+    }
+    void putDown(int id) {
+        sticks[id].unlock();
+        sticks[(id + 1) % n].unlock();
+    }
+};
+
+// Resource ordering: always lock the lower-numbered chopstick first. No cycle
+// can form, so plain blocking locks suffice (no try-and-back-off as in std::lock).
+struct OrderedTable {
+    static const char* name() { return "ordered"; }
+    std::vector<std::mutex> sticks;
+    int n;
+    explicit OrderedTable(int count) : sticks(count), n(count) {}
+    void pickUp(int id) {
+        int first = id, second = (id + 1) % n;
+        if (first > second) std::swap(first, second);
+        sticks[first].lock();
+        sticks[second].lock();
+    }
+    void putDown(int id) {
+        sticks[id].unlock();
+        sticks[(id + 1) % n].unlock();
+    }
+};
+
+// Waiter (arbitrator) with a FIFO queue. A philosopher either gets both chopsticks
+// at once or queues and sleeps on its own condition variable. On every put-down the
+// waiter walks the queue in order; a philosopher still blocked keeps its chopsticks
+// reserved, so someone behind it can't take them, and no one starves.
+struct WaiterTable {
+    static const char* name() { return "waiter_queue"; }
+    std::mutex m;
+    std::vector<char> in_use;
+    std::vector<char> granted;
+    std::vector<std::condition_variable> wake;
+    std::deque<int> queue;
+    std::vector<char> reserved; // Scratch for putDown: chopsticks wanted by blocked philosophers ahead
+    int n;
+
+    explicit WaiterTable(int count)
+        : in_use(count, 0), granted(count, 0), wake(count), reserved(count, 0), n(count) {}
+
+    void pickUp(int id) {
+        int left = id, right = (id + 1) % n;
+        std::unique_lock<std::mutex> lk(m);
+        if (queue.empty() && !in_use[left] && !in_use[right]) {
+            in_use[left] = in_use[right] = 1;
+            return;
+        }
+        queue.push_back(id);
+        wake[id].wait(lk, [&] { return granted[id] != 0; });
+        granted[id] = 0;
+    }
+
+    void putDown(int id) {
+        std::lock_guard<std::mutex> lk(m);
+        in_use[id] = in_use[(id + 1) % n] = 0;
+        std::fill(reserved.begin(), reserved.end(), 0);
+        for (auto it = queue.begin(); it != queue.end();) {
+            int p = *it, left = p, right = (p + 1) % n;
+            if (!in_use[left] && !in_use[right] && !reserved[left] && !reserved[right]) {
+                in_use[left] = in_use[right] = 1;
+                granted[p] = 1;
+                wake[p].notify_one();
+                it = queue.erase(it);
+            } else {
+                reserved[left] = reserved[right] = 1;
+                ++it;
+            }
+        }
+    }
+};
+
+struct DiningBenchOptions {
+    int max_philosophers = 256;
+    int duration_ms = 200;
+    int eat_work = 50;    // Spin iterations while holding both chopsticks
+    int think_work = 50;  // Spin iterations between meals
+    bool per_thread = false;
+};
+
+inline void busyWork(int iterations) {
+    for (int i = 0; i < iterations; ++i) {
+        std::atomic_signal_fence(std::memory_order_seq_cst); // Not optimized away
+    }
+}
+
+template <typename Table>
+void runDiningStrategy(int n, const DiningBenchOptions& opt) {
+    using clock = std::chrono::steady_clock;
+    Table table(n);
+    std::vector<PhilosopherStats> stats(n);
+    std::atomic<bool> stop{false};
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+
+    auto dine = [&](int id) {
+        PhilosopherStats& st = stats[id];
+        ready++;
+        while (!go.load()) std::this_thread::yield(); // Start together, after the clock starts
+        while (!stop.load(std::memory_order_relaxed)) {
+            auto t0 = clock::now();
+            table.pickUp(id);
+            auto t1 = clock::now();
+            busyWork(opt.eat_work);
+            auto t2 = clock::now();
+            table.putDown(id);
+            st.wait.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+            st.hold.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+            st.meals++;
+            busyWork(opt.think_work);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n; ++i) threads.emplace_back(dine, i);
+    while (ready.load() < n) std::this_thread::yield();
+    auto start = clock::now();
+    go = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(opt.duration_ms));
+    stop = true;
+    for (auto& th : threads) th.join();
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    PhilosopherStats total;
+    long long min_meals = stats[0].meals, max_meals = stats[0].meals;
+    for (int i = 0; i < n; ++i) {
+        const PhilosopherStats& s = stats[i];
+        total.wait.merge(s.wait);
+        total.hold.merge(s.hold);
+        total.meals += s.meals;
+        min_meals = std::min(min_meals, s.meals);
+        max_meals = std::max(max_meals, s.meals);
+        if (opt.per_thread) {
+            std::cout << Table::name() << ',' << n << ',' << i << ',' << s.meals << ','
+                      << (long long)(s.meals / seconds) << ',' << s.wait.percentile(0.5) << ','
+                      << s.wait.percentile(0.99) << ',' << s.wait.max_ns << ','
+                      << (long long)s.hold.mean() << ",,\n"; // min/max_meals only apply to "all" rows
+        }
+    }
+    std::cout << Table::name() << ',' << n << ",all," << total.meals << ','
+              << (long long)(total.meals / seconds) << ',' << total.wait.percentile(0.5) << ','
+              << total.wait.percentile(0.99) << ',' << total.wait.max_ns << ','
+              << (long long)total.hold.mean() << ',' << min_meals << ',' << max_meals << '\n';
+}
+
+int runDiningBenchmark(int argc, char** argv) {
+    DiningBenchOptions opt;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--per-thread") {
+            opt.per_thread = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+        int value = std::atoi(argv[++i]);
+        if (arg == "--max-philosophers") opt.max_philosophers = value;
+        else if (arg == "--duration-ms") opt.duration_ms = value;
+        else if (arg == "--eat-work") opt.eat_work = value;
+        else if (arg == "--think-work") opt.think_work = value;
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (opt.max_philosophers < 2 || opt.duration_ms < 1 || opt.eat_work < 0 || opt.think_work < 0) {
+        std::cerr << "Usage: dining_philosophers --bench [--max-philosophers N>=2 (default 256)] [--duration-ms MS] "
+                  << "[--eat-work ITERS] [--think-work ITERS] [--per-thread]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "strategy,philosophers,thread,meals,meals_per_sec,"
+              << "wait_p50_ns,wait_p99_ns,wait_max_ns,hold_avg_ns,min_meals,max_meals\n";
+    for (int n = 2; n <= opt.max_philosophers; n *= 2) {
+        runDiningStrategy<StdLockTable>(n, opt);
+        runDiningStrategy<OrderedTable>(n, opt);
+        runDiningStrategy<WaiterTable>(n, opt);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        return runDiningBenchmark(argc, argv);
+    }
+
     std::cout << "--- Dining Philosophers Problem (using std::mutex) ---" << std::endl;
     std::cout << "Using std::lock for deadlock prevention during acquisition." << std::endl;
 
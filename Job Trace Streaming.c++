@@ -0,0 +1,584 @@
+// job_trace_streaming.cpp
+// Streams job traces (pid, arrival, burst) through FCFS, SJF, SRTF or Round Robin
+// without loading the whole trace into a std::vector<Process>.
+//
+// Input formats (detected from the first bytes of the file):
+//   - Binary: 16-byte header ("CPUTRACE", uint32 version, uint32 record size) followed
+//     by fixed-width records of three little-endian int32 values. Read via mmap.
+//   - CSV: one "pid,arrival,burst" line per job. A header line and lines starting
+//     with '#' are skipped.
+// Traces must be sorted by arrival time. Engines pull arrivals only when the clock
+// reaches them, so memory is bounded by the ready set, not the trace length.
+// Per-job results are written as CSV in completion order; averages go to stderr.
+//
+// Build:
+//   g++ -std=c++17 -O2 "Job Trace Streaming.c++" -o job_trace
+// Usage:
+//   job_trace run <fcfs|sjf|srtf|rr> <trace> [--quantum Q] [--chunk N] [--out file]
+//   job_trace convert <trace.csv> <trace.bin>
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <deque>
+#include <tuple>
+#include <string>
+#include <memory>      // For std::unique_ptr
+#include <algorithm>   // For std::min, std::max
+#include <cerrno>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <fcntl.h>     // For open
+#include <sys/mman.h>  // For mmap
+#include <sys/stat.h>  // For fstat
+#include <unistd.h>    // For close
+
+// One job as stored in a trace
+struct TraceRecord {
+    int32_t pid;
+    int32_t arrival;
+    int32_t burst;
+};
+static_assert(sizeof(TraceRecord) == 12, "TraceRecord must be packed to 12 bytes");
+
+// Binary trace header
+struct TraceHeader {
+    char magic[8];          // "CPUTRACE"
+    uint32_t version;       // 1
+    uint32_t recordSize;    // sizeof(TraceRecord)
+};
+static_assert(sizeof(TraceHeader) == 16, "TraceHeader must be 16 bytes");
+
+const char TRACE_MAGIC[8] = {'C', 'P', 'U', 'T', 'R', 'A', 'C', 'E'};
+const uint32_t TRACE_VERSION = 1;
+
+// Source of trace records, handed out in chunks.
+// nextChunk points `records` at up to maxRecords records and returns how many;
+// 0 means end of trace (or an error, see error()).
+class TraceSource {
+public:
+    virtual ~TraceSource() = default;
+    virtual size_t nextChunk(const TraceRecord*& records, size_t maxRecords) = 0;
+    const std::string& error() const { return error_; }
+
+protected:
+    std::string error_;
+};
+
+// Memory-mapped binary trace. Chunks point straight into the mapping (no copies),
+// so records are read in host byte order; traces are little-endian like x86/ARM hosts.
+class MappedTraceReader : public TraceSource {
+public:
+    ~MappedTraceReader() override {
+        if (data_ != nullptr) munmap(data_, size_);
+    }
+
+    bool open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            error_ = "cannot open " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(TraceHeader)) {
+            error_ = path + " is too small to be a binary trace";
+            ::close(fd);
+            return false;
+        }
+        size_ = st.st_size;
+        void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping stays valid after close
+        if (mapped == MAP_FAILED) {
+            error_ = "mmap failed for " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        data_ = mapped;
+        madvise(data_, size_, MADV_SEQUENTIAL);
+
+        TraceHeader header;
+        std::memcpy(&header, data_, sizeof(header));
+        if (std::memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 ||
+            header.version != TRACE_VERSION || header.recordSize != sizeof(TraceRecord)) {
+            error_ = path + " has an unsupported binary trace header";
+            return false;
+        }
+        if ((size_ - sizeof(TraceHeader)) % sizeof(TraceRecord) != 0) {
+            error_ = path + " ends with a partial record";
+            return false;
+        }
+        records_ = reinterpret_cast<const TraceRecord*>(static_cast<const char*>(data_) + sizeof(TraceHeader));
+        count_ = (size_ - sizeof(TraceHeader)) / sizeof(TraceRecord);
+        return true;
+    }
+
+    size_t nextChunk(const TraceRecord*& records, size_t maxRecords) override {
+        size_t n = std::min(maxRecords, count_ - position_);
+        records = records_ + position_;
+        position_ += n;
+        return n;
+    }
+
+private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+    const TraceRecord* records_ = nullptr;
+    size_t count_ = 0;
+    size_t position_ = 0;
+};
+
+// CSV trace, read through a fixed buffer and parsed by hand (no iostreams)
+class CsvTraceReader : public TraceSource {
+public:
+    ~CsvTraceReader() override {
+        if (file_ != nullptr) std::fclose(file_);
+    }
+
+    bool open(const std::string& path) {
+        file_ = std::fopen(path.c_str(), "rb");
+        if (file_ == nullptr) {
+            error_ = "cannot open " + path + ": " + std::strerror(errno);
+            return false;
+        }
+        buffer_.resize(1 << 20);
+        return true;
+    }
+
+    size_t nextChunk(const TraceRecord*& records, size_t maxRecords) override {
+        chunk_.clear();
+        std::string line;
+        while (chunk_.size() < maxRecords && readLine(line)) {
+            lineNumber_++;
+            if (line.empty() || line[0] == '#') continue;
+            TraceRecord r;
+            if (!parseLine(line, r)) {
+                if (lineNumber_ == 1) continue; // Header row
+                error_ = "bad CSV record on line " + std::to_string(lineNumber_) + ": " + line;
+                chunk_.clear();
+                break;
+            }
+            chunk_.push_back(r);
+        }
+        records = chunk_.data();
+        return chunk_.size();
+    }
+
+private:
+    // Reads one line (without the newline). Returns false at end of file.
+    bool readLine(std::string& line) {
+        line.clear();
+        while (true) {
+            if (pos_ == end_) {
+                end_ = std::fread(buffer_.data(), 1, buffer_.size(), file_);
+                pos_ = 0;
+                if (end_ == 0) return !line.empty();
+            }
+            const char* start = buffer_.data() + pos_;
+            const char* newline = static_cast<const char*>(std::memchr(start, '\n', end_ - pos_));
+            if (newline == nullptr) {
+                line.append(start, end_ - pos_);
+                pos_ = end_;
+                continue;
+            }
+            line.append(start, newline - start);
+            pos_ += (newline - start) + 1;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            return true;
+        }
+    }
+
+    static bool parseField(const char*& p, int32_t& value) {
+        while (*p == ' ' || *p == '\t') ++p;
+        bool negative = (*p == '-');
+        if (negative) ++p;
+        if (*p < '0' || *p > '9') return false;
+        int64_t v = 0;
+        while (*p >= '0' && *p <= '9') {
+            v = v * 10 + (*p - '0');
+            if (v > INT32_MAX) return false;
+            ++p;
+        }
+        while (*p == ' ' || *p == '\t') ++p;
+        value = (int32_t)(negative ? -v : v);
+        return true;
+    }
+
+    static bool parseLine(const std::string& line, TraceRecord& r) {
+        const char* p = line.c_str();
+        if (!parseField(p, r.pid) || *p++ != ',') return false;
+        if (!parseField(p, r.arrival) || *p++ != ',') return false;
+        if (!parseField(p, r.burst)) return false;
+        return *p == '\0';
+    }
+
+    std::FILE* file_ = nullptr;
+    std::vector<char> buffer_;
+    size_t pos_ = 0;
+    size_t end_ = 0;
+    long long lineNumber_ = 0;
+    std::vector<TraceRecord> chunk_;
+};
+
+// Pulls records from a TraceSource one chunk at a time and checks that the trace
+// is valid for the streaming engines (sorted arrivals, positive bursts).
+class ArrivalCursor {
+public:
+    ArrivalCursor(TraceSource& source, size_t chunkSize) : source_(source), chunkSize_(chunkSize) {}
+
+    // True if another valid record is available
+    bool hasNext() {
+        if (index_ < count_) return true;
+        if (failed_) return false;
+        count_ = source_.nextChunk(chunk_, chunkSize_);
+        index_ = 0;
+        if (count_ == 0 && !source_.error().empty()) fail(source_.error());
+        return count_ > 0 && validate(chunk_[0]);
+    }
+
+    const TraceRecord& peek() const { return chunk_[index_]; }
+
+    TraceRecord next() {
+        TraceRecord r = chunk_[index_++];
+        if (index_ < count_) validate(chunk_[index_]);
+        return r;
+    }
+
+    bool failed() const { return failed_; }
+    const std::string& error() const { return error_; }
+
+private:
+    bool validate(const TraceRecord& r) {
+        recordNumber_++;
+        if (r.arrival < lastArrival_ || r.arrival < 0 || r.burst <= 0) {
+            fail("record " + std::to_string(recordNumber_) + " (pid " + std::to_string(r.pid) +
+                 ") has a negative arrival, a non-positive burst, or arrives out of order");
+            return false;
+        }
+        lastArrival_ = r.arrival;
+        return true;
+    }
+
+    void fail(const std::string& message) {
+        failed_ = true;
+        error_ = message;
+        count_ = index_ = 0;
+    }
+
+    TraceSource& source_;
+    size_t chunkSize_;
+    const TraceRecord* chunk_ = nullptr;
+    size_t count_ = 0;
+    size_t index_ = 0;
+    long long recordNumber_ = 0;
+    int32_t lastArrival_ = 0;
+    bool failed_ = false;
+    std::string error_;
+};
+
+// Buffered CSV writer for per-job results. Keeps running totals for the summary.
+class ResultWriter {
+public:
+    explicit ResultWriter(std::FILE* out) : out_(out) {
+        buffer_.reserve(BUFFER_SIZE + 128);
+        buffer_ = "pid,arrival,burst,completion,turnaround,waiting\n";
+    }
+    ~ResultWriter() { flush(); }
+
+    void write(int32_t pid, long long arrival, long long burst, long long completion) {
+        long long turnaround = completion - arrival;
+        long long waiting = turnaround - burst;
+        char line[128];
+        int len = std::snprintf(line, sizeof(line), "%d,%lld,%lld,%lld,%lld,%lld\n",
+                                pid, arrival, burst, completion, turnaround, waiting);
+        buffer_.append(line, len);
+        if (buffer_.size() >= BUFFER_SIZE) flush();
+        jobs_++;
+        totalWaiting_ += waiting;
+        totalTurnaround_ += turnaround;
+        makespan_ = std::max(makespan_, completion);
+    }
+
+    // Once a write fails, later output is dropped and failed() stays true
+    void flush() {
+        if (!buffer_.empty() && !failed_) {
+            failed_ = std::fwrite(buffer_.data(), 1, buffer_.size(), out_) != buffer_.size();
+        }
+        buffer_.clear();
+    }
+
+    // Flushes the buffer and the stream itself. Returns false if any write failed.
+    bool finish() {
+        flush();
+        if (!failed_ && std::fflush(out_) != 0) failed_ = true;
+        return !failed_;
+    }
+
+    bool failed() const { return failed_; }
+
+    void printSummary(std::ostream& os) const {
+        os << "Jobs                    : " << jobs_ << "\n"
+           << "Makespan                : " << makespan_ << "\n";
+        if (jobs_ > 0) {
+            os.setf(std::ios::fixed);
+            os.precision(2);
+            os << "Average Waiting Time    : " << (double)totalWaiting_ / jobs_ << "\n"
+               << "Average Turnaround Time : " << (double)totalTurnaround_ / jobs_ << "\n";
+        }
+    }
+
+private:
+    static const size_t BUFFER_SIZE = 1 << 20;
+    std::FILE* out_;
+    std::string buffer_;
+    bool failed_ = false;
+    long long jobs_ = 0;
+    long long totalWaiting_ = 0;
+    long long totalTurnaround_ = 0;
+    long long makespan_ = 0;
+};
+
+// A job that has arrived and not yet finished
+struct LiveJob {
+    int32_t pid;
+    long long arrival;
+    long long burst;
+    long long remaining;
+};
+
+// --- Streaming FCFS ---
+// Only the current job is ever held in memory.
+void streamFcfs(ArrivalCursor& arrivals, ResultWriter& out) {
+    long long currentTime = 0;
+    while (arrivals.hasNext()) {
+        TraceRecord r = arrivals.next();
+        currentTime = std::max<long long>(currentTime, r.arrival) + r.burst;
+        out.write(r.pid, r.arrival, r.burst, currentTime);
+    }
+}
+
+// Min-heap order on (key, arrival, pid); key is burst for SJF, remaining for SRTF
+struct ShorterJobFirst {
+    bool preemptive;
+    bool operator()(const LiveJob& a, const LiveJob& b) const {
+        long long ka = preemptive ? a.remaining : a.burst;
+        long long kb = preemptive ? b.remaining : b.burst;
+        return std::tie(ka, a.arrival, a.pid) > std::tie(kb, b.arrival, b.pid);
+    }
+};
+
+// --- Streaming SJF / SRTF ---
+// Same schedule as calculateSJF_Heap and calculateSRTF_EventDriven.
+void streamShortestJob(ArrivalCursor& arrivals, ResultWriter& out, bool preemptive) {
+    std::priority_queue<LiveJob, std::vector<LiveJob>, ShorterJobFirst> ready(ShorterJobFirst{preemptive});
+    long long currentTime = 0;
+
+    while (true) {
+        while (arrivals.hasNext() && arrivals.peek().arrival <= currentTime) {
+            TraceRecord r = arrivals.next();
+            ready.push(LiveJob{r.pid, r.arrival, r.burst, r.burst});
+        }
+        if (ready.empty()) {
+            if (!arrivals.hasNext()) break;
+            currentTime = arrivals.peek().arrival; // CPU idle until the next arrival
+            continue;
+        }
+
+        LiveJob job = ready.top();
+        ready.pop();
+        long long runFor = job.remaining;
+        if (preemptive && arrivals.hasNext()) {
+            runFor = std::min(runFor, arrivals.peek().arrival - currentTime);
+        }
+        job.remaining -= runFor;
+        currentTime += runFor;
+
+        if (job.remaining == 0) {
+            out.write(job.pid, job.arrival, job.burst, currentTime);
+        } else {
+            ready.push(job); // Interrupted by an arrival
+        }
+    }
+}
+
+// --- Streaming Round Robin ---
+// Same schedule as runRoundRobin: arrivals during a slice queue ahead of the preempted job.
+void streamRoundRobin(ArrivalCursor& arrivals, ResultWriter& out, long long quantum) {
+    std::deque<LiveJob> ready;
+    long long currentTime = 0;
+
+    auto admitArrivals = [&]() {
+        while (arrivals.hasNext() && arrivals.peek().arrival <= currentTime) {
+            TraceRecord r = arrivals.next();
+            ready.push_back(LiveJob{r.pid, r.arrival, r.burst, r.burst});
+        }
+    };
+
+    admitArrivals();
+    while (true) {
+        if (ready.empty()) {
+            if (!arrivals.hasNext()) break;
+            currentTime = arrivals.peek().arrival;
+            admitArrivals();
+        }
+
+        LiveJob job = ready.front();
+        ready.pop_front();
+        long long timeSlice = std::min(quantum, job.remaining);
+        job.remaining -= timeSlice;
+        currentTime += timeSlice;
+        admitArrivals();
+
+        if (job.remaining == 0) {
+            out.write(job.pid, job.arrival, job.burst, currentTime);
+        } else {
+            ready.push_back(job);
+        }
+    }
+}
+
+// Opens `path` as a binary trace if it starts with the magic bytes, otherwise as CSV
+std::unique_ptr<TraceSource> openTrace(const std::string& path, std::string& error) {
+    char magic[sizeof(TRACE_MAGIC)] = {};
+    if (std::FILE* f = std::fopen(path.c_str(), "rb")) {
+        size_t got = std::fread(magic, 1, sizeof(magic), f);
+        std::fclose(f);
+        if (got == sizeof(magic) && std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0) {
+            std::unique_ptr<MappedTraceReader> reader(new MappedTraceReader());
+            if (reader->open(path)) return reader;
+            error = reader->error();
+            return nullptr;
+        }
+    }
+    std::unique_ptr<CsvTraceReader> reader(new CsvTraceReader());
+    if (reader->open(path)) return reader;
+    error = reader->error();
+    return nullptr;
+}
+
+// Converts any readable trace into the binary format, one chunk at a time
+bool convertTrace(const std::string& inPath, const std::string& outPath, size_t chunkSize, std::string& error) {
+    std::unique_ptr<TraceSource> source = openTrace(inPath, error);
+    if (source == nullptr) return false;
+
+    std::FILE* out = std::fopen(outPath.c_str(), "wb");
+    if (out == nullptr) {
+        error = "cannot create " + outPath + ": " + std::strerror(errno);
+        return false;
+    }
+    TraceHeader header;
+    std::memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.recordSize = sizeof(TraceRecord);
+    bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1;
+
+    const TraceRecord* records;
+    size_t n;
+    while (ok && (n = source->nextChunk(records, chunkSize)) > 0) {
+        ok = std::fwrite(records, sizeof(TraceRecord), n, out) == n;
+    }
+    if (!source->error().empty()) {
+        error = source->error();
+        ok = false;
+    } else if (!ok) {
+        error = "write failed for " + outPath;
+    }
+    if (std::fclose(out) != 0 && ok) {
+        error = "write failed for " + outPath;
+        ok = false;
+    }
+    return ok;
+}
+
+#ifndef SCHEDULER_NO_MAIN
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  job_trace run <fcfs|sjf|srtf|rr> <trace> [--quantum Q] [--chunk N] [--out file]\n"
+              << "  job_trace convert <trace.csv> <trace.bin> [--chunk N]\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        printUsage();
+        return 1;
+    }
+    std::string command = argv[1];
+    long long quantum = 4;
+    size_t chunkSize = 1 << 16;
+    std::string outPath;
+
+    for (int i = 4; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--quantum") quantum = std::atoll(value.c_str());
+        else if (arg == "--chunk") chunkSize = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--out") outPath = value;
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (quantum <= 0 || chunkSize == 0) {
+        std::cerr << "Error: Quantum and chunk size must be positive." << std::endl;
+        return 1;
+    }
+
+    std::string error;
+    if (command == "convert") {
+        if (!convertTrace(argv[2], argv[3], chunkSize, error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (command != "run") {
+        printUsage();
+        return 1;
+    }
+
+    std::string policy = argv[2];
+    if (policy != "fcfs" && policy != "sjf" && policy != "srtf" && policy != "rr") {
+        std::cerr << "Error: Unknown policy '" << policy << "'." << std::endl;
+        return 1;
+    }
+
+    std::unique_ptr<TraceSource> source = openTrace(argv[3], error);
+    if (source == nullptr) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    std::FILE* outFile = stdout;
+    if (!outPath.empty()) {
+        outFile = std::fopen(outPath.c_str(), "wb");
+        if (outFile == nullptr) {
+            std::cerr << "Error: cannot create " << outPath << std::endl;
+            return 1;
+        }
+    }
+
+    ArrivalCursor arrivals(*source, chunkSize);
+    ResultWriter out(outFile);
+    if (policy == "fcfs") streamFcfs(arrivals, out);
+    else if (policy == "sjf") streamShortestJob(arrivals, out, false);
+    else if (policy == "srtf") streamShortestJob(arrivals, out, true);
+    else streamRoundRobin(arrivals, out, quantum);
+
+    bool writeOk = out.finish();
+    if (outFile != stdout && std::fclose(outFile) != 0) writeOk = false;
+
+    if (arrivals.failed()) {
+        std::cerr << "Error: " << arrivals.error() << std::endl;
+        return 1;
+    }
+    if (!writeOk) {
+        std::cerr << "Error: write failed for " << (outPath.empty() ? "standard output" : outPath) << std::endl;
+        return 1;
+    }
+    out.printSummary(std::cerr);
+    return 0;
+}
+#endif
@@ -0,0 +1,399 @@
+// multicore_scheduling.cpp
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <tuple>
+#include <string>
+#include <random>
+#include <limits>     // For std::numeric_limits
+#include <iomanip>    // For formatting output
+#include <algorithm>  // For std::stable_sort, std::min
+
+// Scheduling policy applied to every core's run queue
+enum class Policy { FCFS, SJF, SRTF, RR };
+
+const char* policyName(Policy policy) {
+    switch (policy) {
+        case Policy::FCFS: return "FCFS";
+        case Policy::SJF:  return "SJF (Non-Preemptive)";
+        case Policy::SRTF: return "SRTF (Preemptive SJF)";
+        case Policy::RR:   return "Round Robin";
+    }
+    return "?";
+}
+
+// Structure to represent a job. Times are long long so multi-million job
+// traces cannot overflow the clock.
+struct Job {
+    int id;                     // Job ID
+    long long arrivalTime;      // Arrival Time (AT)
+    long long burstTime;        // Burst Time (BT)
+    long long remainingTime;    // Remaining run time, including any migration penalty
+    long long completionTime;   // Completion Time (CT)
+    long long turnaroundTime;   // Turnaround Time (TAT)
+    long long waitingTime;      // Waiting Time (WT = TAT - BT, so migration penalties count as waiting)
+    int lastCore;               // Core the job last ran on (-1 = never ran)
+    int migrations;             // Times the job resumed on a different core
+
+    Job(int i = 0, long long at = 0, long long bt = 0)
+        : id(i), arrivalTime(at), burstTime(bt), remainingTime(bt),
+          completionTime(0), turnaroundTime(0), waitingTime(0), lastCore(-1), migrations(0) {}
+};
+
+// Simulated machine and policy settings
+struct MultiCoreConfig {
+    int numCores = 4;
+    Policy policy = Policy::FCFS;
+    long long quantum = 2;         // Time slice, Round Robin only
+    long long migrationCost = 0;   // Extra run time charged when a job resumes on a different core
+    bool workStealing = true;      // Let a core with an empty run queue take work from the busiest core
+};
+
+// Per-core counters reported after the run
+struct CoreStats {
+    long long busyTime = 0;        // Time spent running jobs (migration penalties included)
+    long long jobsCompleted = 0;
+    long long steals = 0;          // Jobs this core took from another core's run queue
+    long long migrationsIn = 0;    // Jobs that resumed here after running elsewhere
+    double utilization = 0;        // busyTime / makespan
+};
+
+struct MultiCoreReport {
+    std::vector<CoreStats> cores;
+    long long makespan = 0;
+    long long totalMigrations = 0;
+    long long totalSteals = 0;
+    double avgWaitingTime = 0;
+    double avgTurnaroundTime = 0;
+};
+
+// Run queue entry. Ordering key depends on the policy:
+//   FCFS: (arrival rank)   SJF: (burst, arrival, id)
+//   SRTF: (remaining, arrival, id)   RR: (enqueue sequence number)
+struct ReadyEntry {
+    long long primary;
+    long long secondary;
+    int tertiary;
+    int job;            // Index into the jobs vector
+
+    bool operator>(const ReadyEntry& other) const {
+        return std::tie(primary, secondary, tertiary) > std::tie(other.primary, other.secondary, other.tertiary);
+    }
+};
+
+// Simulated CPU
+struct Core {
+    std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> runQueue;
+    int running = -1;           // Job index, -1 when idle
+    long long sliceStart = 0;
+    unsigned version = 0;       // Bumped on every dispatch/preemption to invalidate stale events
+    bool idle = true;
+    bool touched = false;       // Received an arrival in the batch being placed
+};
+
+// End of the current slice on a core
+struct CoreEvent {
+    long long time;
+    int core;
+    unsigned version;
+
+    bool operator>(const CoreEvent& other) const {
+        return std::tie(time, core) > std::tie(other.time, other.core);
+    }
+};
+
+// --- Multi-Core Scheduling Simulation ---
+// Discrete-event simulation of `config.numCores` CPUs, each with its own run queue.
+// Arrivals go to an idle core if one exists, otherwise round-robin across cores.
+// A core whose run queue runs dry steals the best queued job from the core with the
+// longest run queue. Only the next arrival and one pending event per core are ever
+// tracked, so the cost is O(n log n) plus O(cores) per steal.
+// Ties at the same instant: arrivals are handled before slice ends, so a Round Robin
+// job preempted at time t queues behind jobs that arrive at t (as in roundRobinScheduling).
+MultiCoreReport simulateMultiCore(std::vector<Job>& jobs, const MultiCoreConfig& config) {
+    MultiCoreReport report;
+    int n = jobs.size();
+    int numCores = config.numCores;
+    if (numCores <= 0) {
+        std::cerr << "Error: Number of cores must be positive." << std::endl;
+        return report;
+    }
+    if (config.policy == Policy::RR && config.quantum <= 0) {
+        std::cerr << "Error: Time quantum must be positive." << std::endl;
+        return report;
+    }
+    if (config.migrationCost < 0) {
+        std::cerr << "Error: Migration cost cannot be negative." << std::endl;
+        return report;
+    }
+    report.cores.assign(numCores, CoreStats());
+    if (n == 0) return report;
+
+    for (auto& job : jobs) {
+        job.remainingTime = job.burstTime;
+        job.lastCore = -1;
+        job.migrations = 0;
+    }
+
+    std::vector<int> arrivalOrder(n);
+    for (int i = 0; i < n; ++i) arrivalOrder[i] = i;
+    std::stable_sort(arrivalOrder.begin(), arrivalOrder.end(),
+                     [&](int a, int b){ return jobs[a].arrivalTime < jobs[b].arrivalTime; });
+    std::vector<int> arrivalRank(n);
+    for (int i = 0; i < n; ++i) arrivalRank[arrivalOrder[i]] = i;
+
+    std::vector<Core> cores(numCores);
+    std::vector<CoreStats>& stats = report.cores;
+    std::priority_queue<CoreEvent, std::vector<CoreEvent>, std::greater<CoreEvent>> events;
+    std::vector<int> idleCores;                 // Cores with nothing to run
+    for (int c = 0; c < numCores; ++c) idleCores.push_back(c);
+    std::vector<int> touchedCores;              // Cores that received arrivals in the current batch
+    long long enqueueSeq = 0;
+    long long totalQueued = 0;
+    int homeCursor = 0;
+    int idleCursor = 0;
+
+    auto makeEntry = [&](int j) {
+        const Job& job = jobs[j];
+        switch (config.policy) {
+            case Policy::FCFS: return ReadyEntry{arrivalRank[j], 0, 0, j};
+            case Policy::SJF:  return ReadyEntry{job.burstTime, job.arrivalTime, job.id, j};
+            case Policy::SRTF: return ReadyEntry{job.remainingTime, job.arrivalTime, job.id, j};
+            case Policy::RR:   break;
+        }
+        return ReadyEntry{enqueueSeq++, 0, 0, j};
+    };
+
+    auto enqueue = [&](int c, int j) {
+        cores[c].runQueue.push(makeEntry(j));
+        totalQueued++;
+    };
+
+    auto dispatch = [&](int c, int j, long long now) {
+        Job& job = jobs[j];
+        if (job.lastCore != -1 && job.lastCore != c) {
+            job.migrations++;
+            job.remainingTime += config.migrationCost;
+            stats[c].migrationsIn++;
+            report.totalMigrations++;
+        }
+        job.lastCore = c;
+
+        long long slice = job.remainingTime;
+        if (config.policy == Policy::RR) slice = std::min(slice, config.quantum);
+
+        Core& core = cores[c];
+        core.running = j;
+        core.sliceStart = now;
+        core.idle = false;
+        core.version++;
+        events.push(CoreEvent{now + slice, c, core.version});
+    };
+
+    // Pick the next job for core c: own run queue first, then steal, else go idle
+    auto startNext = [&](int c, long long now) {
+        Core& core = cores[c];
+        if (!core.runQueue.empty()) {
+            int j = core.runQueue.top().job;
+            core.runQueue.pop();
+            totalQueued--;
+            dispatch(c, j, now);
+            return;
+        }
+        if (config.workStealing && totalQueued > 0) {
+            int victim = -1;
+            size_t longest = 0;
+            for (int v = 0; v < numCores; ++v) {
+                if (cores[v].runQueue.size() > longest) {
+                    longest = cores[v].runQueue.size();
+                    victim = v;
+                }
+            }
+            int j = cores[victim].runQueue.top().job;
+            cores[victim].runQueue.pop();
+            totalQueued--;
+            stats[c].steals++;
+            report.totalSteals++;
+            dispatch(c, j, now);
+            return;
+        }
+        core.running = -1;
+        core.idle = true;
+        idleCores.push_back(c);
+    };
+
+    // SRTF: preempt the running job if a queued job now has a smaller key
+    auto maybePreempt = [&](int c, long long now) {
+        Core& core = cores[c];
+        if (core.running == -1 || core.runQueue.empty()) return;
+        Job& running = jobs[core.running];
+        long long remainingNow = running.remainingTime - (now - core.sliceStart);
+        ReadyEntry current{remainingNow, running.arrivalTime, running.id, core.running};
+        if (!(current > core.runQueue.top())) return;
+
+        stats[c].busyTime += now - core.sliceStart;
+        running.remainingTime = remainingNow;
+        enqueue(c, core.running);
+        core.running = -1;
+        startNext(c, now);
+    };
+
+    int completed = 0;
+    int nextArrival = 0; // Cursor into arrivalOrder
+    const long long NEVER = std::numeric_limits<long long>::max();
+
+    while (completed < n) {
+        while (!events.empty() && events.top().version != cores[events.top().core].version) {
+            events.pop(); // Stale: the core was preempted since this event was scheduled
+        }
+        long long nextArrivalTime = nextArrival < n ? jobs[arrivalOrder[nextArrival]].arrivalTime : NEVER;
+        long long nextEventTime = events.empty() ? NEVER : events.top().time;
+
+        if (nextArrivalTime <= nextEventTime) {
+            // Place every job arriving at this instant before any core picks, so a
+            // core choosing between simultaneous arrivals sees all of them
+            long long now = nextArrivalTime;
+            while (nextArrival < n && jobs[arrivalOrder[nextArrival]].arrivalTime == now) {
+                int j = arrivalOrder[nextArrival++];
+                int c;
+                if (!idleCores.empty()) {
+                    c = idleCores[idleCursor++ % idleCores.size()];
+                } else {
+                    c = homeCursor;
+                    homeCursor = (homeCursor + 1) % numCores;
+                }
+                if (!cores[c].touched) {
+                    cores[c].touched = true;
+                    touchedCores.push_back(c);
+                }
+                enqueue(c, j);
+            }
+            idleCursor = 0;
+
+            for (int c : touchedCores) {
+                cores[c].touched = false;
+                if (cores[c].idle) {
+                    idleCores.erase(std::find(idleCores.begin(), idleCores.end(), c));
+                    startNext(c, now);
+                } else if (config.policy == Policy::SRTF) {
+                    maybePreempt(c, now);
+                }
+            }
+            touchedCores.clear();
+            continue;
+        }
+
+        CoreEvent event = events.top();
+        events.pop();
+        Core& core = cores[event.core];
+        int j = core.running;
+        Job& job = jobs[j];
+
+        stats[event.core].busyTime += event.time - core.sliceStart;
+        job.remainingTime -= event.time - core.sliceStart;
+        core.running = -1;
+
+        if (job.remainingTime == 0) {
+            job.completionTime = event.time;
+            job.turnaroundTime = job.completionTime - job.arrivalTime;
+            job.waitingTime = job.turnaroundTime - job.burstTime;
+            stats[event.core].jobsCompleted++;
+            report.makespan = std::max(report.makespan, event.time);
+            completed++;
+        } else {
+            enqueue(event.core, j); // Round Robin slice expired
+        }
+        startNext(event.core, event.time);
+    }
+
+    double totalWT = 0;
+    double totalTAT = 0;
+    for (const auto& job : jobs) {
+        totalWT += job.waitingTime;
+        totalTAT += job.turnaroundTime;
+    }
+    report.avgWaitingTime = totalWT / n;
+    report.avgTurnaroundTime = totalTAT / n;
+    for (auto& s : stats) {
+        s.utilization = report.makespan > 0 ? (double)s.busyTime / report.makespan : 0;
+    }
+    return report;
+}
+
+// Function to display per-core results
+void displayReport(const MultiCoreConfig& config, const MultiCoreReport& report, bool showCores = true) {
+    std::cout << "\n--- " << policyName(config.policy) << " on " << config.numCores << " cores";
+    if (config.policy == Policy::RR) std::cout << " (Quantum = " << config.quantum << ")";
+    std::cout << ", migration cost " << config.migrationCost
+              << ", work stealing " << (config.workStealing ? "on" : "off") << " ---\n";
+
+    std::cout << std::fixed << std::setprecision(2);
+    if (showCores) {
+        std::cout << "---------------------------------------------------------------------\n";
+        std::cout << std::setw(6) << "Core" << std::setw(12) << "Busy Time"
+                  << std::setw(15) << "Utilization %"
+                  << std::setw(12) << "Jobs Done"
+                  << std::setw(10) << "Steals"
+                  << std::setw(14) << "Migrations" << std::endl;
+        std::cout << "---------------------------------------------------------------------\n";
+        for (size_t c = 0; c < report.cores.size(); ++c) {
+            const CoreStats& s = report.cores[c];
+            std::cout << std::setw(6) << c
+                      << std::setw(12) << s.busyTime
+                      << std::setw(15) << s.utilization * 100
+                      << std::setw(12) << s.jobsCompleted
+                      << std::setw(10) << s.steals
+                      << std::setw(14) << s.migrationsIn << std::endl;
+        }
+        std::cout << "---------------------------------------------------------------------\n";
+    }
+    std::cout << "Makespan                : " << report.makespan << std::endl;
+    std::cout << "Total Steals            : " << report.totalSteals << std::endl;
+    std::cout << "Total Migrations        : " << report.totalMigrations << std::endl;
+    std::cout << "Average Waiting Time    : " << report.avgWaitingTime << std::endl;
+    std::cout << "Average Turnaround Time : " << report.avgTurnaroundTime << std::endl;
+}
+
+int main() {
+    // Example jobs: (ID, Arrival Time, Burst Time)
+    std::vector<Job> jobs = {
+        {1, 0, 8}, {2, 0, 4}, {3, 1, 9}, {4, 2, 5}, {5, 3, 2},
+        {6, 3, 7}, {7, 5, 3}, {8, 6, 6}, {9, 8, 1}, {10, 9, 4},
+        {11, 10, 10}, {12, 12, 2}
+    };
+
+    std::cout << "--- Multi-Core Scheduling Simulation ---" << std::endl;
+
+    MultiCoreConfig config;
+    config.numCores = 2;
+    config.migrationCost = 1;
+    for (Policy policy : {Policy::FCFS, Policy::SJF, Policy::SRTF, Policy::RR}) {
+        config.policy = policy;
+        MultiCoreReport report = simulateMultiCore(jobs, config);
+        displayReport(config, report);
+    }
+
+    // Larger synthetic run: many cores, many jobs, per-core table omitted
+    const int NUM_JOBS = 1000000;
+    std::mt19937 gen(42);
+    std::exponential_distribution<> interArrival(4.5); // ~90% load on 256 cores
+    std::uniform_int_distribution<> burst(1, 100);
+    std::vector<Job> bigWorkload;
+    bigWorkload.reserve(NUM_JOBS);
+    double clock = 0;
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        clock += interArrival(gen);
+        bigWorkload.emplace_back(i + 1, (long long)clock, burst(gen));
+    }
+
+    MultiCoreConfig bigConfig;
+    bigConfig.numCores = 256;
+    bigConfig.policy = Policy::RR;
+    bigConfig.quantum = 10;
+    bigConfig.migrationCost = 2;
+    MultiCoreReport bigReport = simulateMultiCore(bigWorkload, bigConfig);
+    std::cout << "\n" << NUM_JOBS << " synthetic jobs:";
+    displayReport(bigConfig, bigReport, false);
+
+    return 0;
+}
@@ -4,25 +4,62 @@
 #include <queue>
 #include <unordered_set>
 #include <unordered_map>
-#include <list>
-#include <algorithm> // For std::find, std::max_element
+#include <algorithm> // For std::find, std::max_element, heap operations
 #include <limits>    // For std::numeric_limits
+#include <iomanip>   // For formatting output
+#include <thread>    // Parallel per-capacity runs
+#include <atomic>
+
+// --- Reference String Preprocessing (shared by the fast, non-tracing paths) ---
+// Maps every page number to a dense id in [0, distinct) so per-page state can live
+// in flat vectors instead of hash maps. next_use is only filled when requested.
+struct PageTrace {
+    std::vector<int> ids;       // Dense page id of each reference
+    std::vector<int> next_use;  // Index of the next reference to the same page (ids.size() if none)
+    int distinct = 0;
+};
+
+PageTrace preparePageTrace(const std::vector<int>& pages, bool with_next_use) {
+    PageTrace trace;
+    int len = pages.size();
+    trace.ids.resize(len);
+    std::unordered_map<int, int> dense_id;
+    for (int i = 0; i < len; ++i) {
+        auto it = dense_id.find(pages[i]);
+        if (it == dense_id.end()) it = dense_id.emplace(pages[i], (int)dense_id.size()).first;
+        trace.ids[i] = it->second;
+    }
+    trace.distinct = dense_id.size();
+
+    if (with_next_use) {
+        // Backward pass: remember the nearest later reference of every page
+        trace.next_use.resize(len);
+        std::vector<int> upcoming(trace.distinct, len);
+        for (int i = len - 1; i >= 0; --i) {
+            trace.next_use[i] = upcoming[trace.ids[i]];
+            upcoming[trace.ids[i]] = i;
+        }
+    }
+    return trace;
+}
 
 // --- FIFO Page Replacement ---
-int fifoPageReplacement(const std::vector<int>& pages, int capacity) {
+int fifoPageReplacement(const std::vector<int>& pages, int capacity, bool trace = false) {
     if (capacity <= 0) return pages.size(); // Every access is a fault if no capacity
 
     std::unordered_set<int> current_frames; // Pages currently in memory frames
     std::queue<int> fifo_queue;             // Order pages entered frames
     int page_faults = 0;
 
-    std::cout << "\n--- FIFO Simulation ---" << std::endl;
-    std::cout << "Ref | Frames" << std::endl;
-    std::cout << "----|--------" << std::endl;
+    if (trace) {
+        std::cout << "\n--- FIFO Simulation ---" << std::endl;
+        std::cout << "Ref | Frames" << std::endl;
+        std::cout << "----|--------" << std::endl;
+    }
 
 
     for (int page : pages) {
-        std::cout << " " << page << "  | ";
+        if (trace) std::cout << " " << page << "  | ";
         // Check if page is NOT in frames (page fault)
         if (current_frames.find(page) == current_frames.end()) {
             page_faults++;
@@ -32,9 +69,9 @@ int fifoPageReplacement(const std::vector<int>& pages, int capacity) {
                 int page_to_remove = fifo_queue.front();
                 fifo_queue.pop();
                 current_frames.erase(page_to_remove);
-                 std::cout << "(Fault - Evict " << page_to_remove << ") ";
+                 if (trace) std::cout << "(Fault - Evict " << page_to_remove << ") ";
             } else {
-                 std::cout << "(Fault) ";
+                 if (trace) std::cout << "(Fault) ";
             }
 
             // Add the new page
@@ -43,8 +80,9 @@ int fifoPageReplacement(const std::vector<int>& pages, int capacity) {
 
         } else {
             // Page hit - no fault
-             std::cout << "(Hit)   ";
+             if (trace) std::cout << "(Hit)   ";
         }
+        if (!trace) continue;
 
         // Print current frames (order might not match queue, set is unordered)
          std::cout << "[";
@@ -64,55 +102,82 @@ int fifoPageReplacement(const std::vector<int>& pages, int capacity) {
 }
 
 // --- LRU Page Replacement ---
-int lruPageReplacement(const std::vector<int>& pages, int capacity) {
+int lruPageReplacement(const std::vector<int>& pages, int capacity, bool trace = false) {
      if (capacity <= 0) return pages.size();
 
-    // Store pages currently in frames. Using list to easily move elements.
-    // Front = Most Recently Used, Back = Least Recently Used
-    std::list<int> frame_list;
-    // Map page number to its iterator in the list for O(1) access
-    std::unordered_map<int, std::list<int>::iterator> frame_map;
+    PageTrace refs = preparePageTrace(pages, false);
+
+    // Frames form a doubly linked list threaded through a fixed pool of slots
+    // (no per-node allocation). Front = Most Recently Used, Back = Least Recently Used
+    int num_slots = std::min(capacity, refs.distinct);
+    std::vector<int> slot_page(num_slots);      // Page number held by each slot
+    std::vector<int> slot_id(num_slots);        // Dense id held by each slot
+    std::vector<int> prev(num_slots), next(num_slots);
+    std::vector<int> slot_of(refs.distinct, -1); // Dense id -> slot, -1 if not resident
+    int head = -1, tail = -1, used = 0;
     int page_faults = 0;
 
-    std::cout << "\n--- LRU Simulation ---" << std::endl;
-    std::cout << "Ref | Frames (MRU..LRU)" << std::endl;
-    std::cout << "----|------------------" << std::endl;
+    auto unlink = [&](int s) {
+        if (prev[s] != -1) next[prev[s]] = next[s]; else head = next[s];
+        if (next[s] != -1) prev[next[s]] = prev[s]; else tail = prev[s];
+    };
+    auto push_front = [&](int s) {
+        prev[s] = -1;
+        next[s] = head;
+        if (head != -1) prev[head] = s;
+        head = s;
+        if (tail == -1) tail = s;
+    };
+
+    if (trace) {
+        std::cout << "\n--- LRU Simulation ---" << std::endl;
+        std::cout << "Ref | Frames (MRU..LRU)" << std::endl;
+        std::cout << "----|------------------" << std::endl;
+    }
 
-    for (int page : pages) {
-         std::cout << " " << page << "  | ";
+    for (size_t i = 0; i < pages.size(); ++i) {
+        int page = pages[i];
+        int id = refs.ids[i];
+        if (trace) std::cout << " " << page << "  | ";
         // Check if page is NOT in frames (page fault)
-        if (frame_map.find(page) == frame_map.end()) {
+        if (slot_of[id] == -1) {
             page_faults++;
 
-            // If frames are full, remove the LRU page (back of list)
-            if (frame_list.size() == capacity) {
-                int lru_page = frame_list.back();
-                frame_list.pop_back();
-                frame_map.erase(lru_page);
-                 std::cout << "(Fault - Evict " << lru_page << ") ";
+            int s;
+            // If frames are full, reuse the LRU slot (back of list)
+            if (used == capacity) {
+                s = tail;
+                unlink(s);
+                slot_of[slot_id[s]] = -1;
+                if (trace) std::cout << "(Fault - Evict " << slot_page[s] << ") ";
             } else {
-                 std::cout << "(Fault) ";
+                s = used++;
+                if (trace) std::cout << "(Fault) ";
             }
 
             // Add the new page to the front (MRU)
-            frame_list.push_front(page);
-            frame_map[page] = frame_list.begin();
+            slot_page[s] = page;
+            slot_id[s] = id;
+            slot_of[id] = s;
+            push_front(s);
 
         } else {
             // Page hit - Move the accessed page to the front (MRU)
-            std::cout << "(Hit)   ";
-            // Erase from current position and add to front
-            frame_list.erase(frame_map[page]);
-            frame_list.push_front(page);
-            frame_map[page] = frame_list.begin(); // Update iterator in map
+            if (trace) std::cout << "(Hit)   ";
+            int s = slot_of[id];
+            if (s != head) {
+                unlink(s);
+                push_front(s);
+            }
         }
+        if (!trace) continue;
 
         // Print current frames (in MRU -> LRU order)
         std::cout << "[";
         bool first = true;
-        for(int p : frame_list) {
+        for (int s = head; s != -1; s = next[s]) {
             if(!first) std::cout << ", ";
-            std::cout << p;
+            std::cout << slot_page[s];
             first = false;
         }
         std::cout << "]" << std::endl;
@@ -121,20 +186,22 @@ int lruPageReplacement(const std::vector<int>& pages, int capacity) {
 }
 
 // --- Optimal Page Replacement ---
-int optimalPageReplacement(const std::vector<int>& pages, int capacity) {
+int optimalPageReplacement(const std::vector<int>& pages, int capacity, bool trace = false) {
     if (capacity <= 0) return pages.size();
 
     std::unordered_set<int> current_frames; // Can use set or vector
     std::vector<int> frame_vector; // To keep track of order for printing
     int page_faults = 0;
 
-    std::cout << "\n--- Optimal Simulation ---" << std::endl;
-    std::cout << "Ref | Frames" << std::endl;
-    std::cout << "----|--------" << std::endl;
+    if (trace) {
+        std::cout << "\n--- Optimal Simulation ---" << std::endl;
+        std::cout << "Ref | Frames" << std::endl;
+        std::cout << "----|--------" << std::endl;
+    }
 
     for (size_t i = 0; i < pages.size(); ++i) {
         int page = pages[i];
-        std::cout << " " << page << "  | ";
+        if (trace) std::cout << " " << page << "  | ";
 
         // Check if page is NOT in frames (page fault)
         if (current_frames.find(page) == current_frames.end()) {
@@ -166,13 +233,13 @@ int optimalPageReplacement(const std::vector<int>& pages, int capacity) {
                      // This implementation picks the last one checked among those never used again.
                 }
 
-                 std::cout << "(Fault - Evict " << page_to_evict << ") ";
+                 if (trace) std::cout << "(Fault - Evict " << page_to_evict << ") ";
                 current_frames.erase(page_to_evict);
                 // Remove from vector too (find and erase)
                  frame_vector.erase(std::remove(frame_vector.begin(), frame_vector.end(), page_to_evict), frame_vector.end());
 
             } else {
-                std::cout << "(Fault) ";
+                if (trace) std::cout << "(Fault) ";
             }
 
             // Add the new page
@@ -180,9 +247,10 @@ int optimalPageReplacement(const std::vector<int>& pages, int capacity) {
              frame_vector.push_back(page); // Add to vector for tracking
 
         } else {
-             std::cout << "(Hit)   ";
+             if (trace) std::cout << "(Hit)   ";
             // Page hit - no fault, no change in frames needed for Optimal
         }
+        if (!trace) continue;
          // Print current frames
         std::cout << "[";
         bool first = true;
@@ -196,6 +264,170 @@ int optimalPageReplacement(const std::vector<int>& pages, int capacity) {
     return page_faults;
 }
 
+// --- Optimal Page Replacement (Belady), Next-Use Indices ---
+// Same fault count as optimalPageReplacement without the forward scans:
+// preparePageTrace records, for every reference, where that page is used next.
+// Resident pages sit in a max-heap keyed by next use, so a fault evicts the top.
+// Hits push a fresh entry instead of updating in place; outdated entries are skipped
+// on eviction, and the heap is compacted once it grows past twice the resident count.
+// Each reference costs O(log capacity) amortized.
+int optimalFaults(const PageTrace& refs, int capacity) {
+    int len = refs.ids.size();
+    if (capacity <= 0) return len;
+
+    std::vector<int> resident_next(refs.distinct, -1); // Next use of a resident page, -1 if not resident
+    int resident_count = 0;
+    std::vector<std::pair<int, int>> farthest; // Max-heap of (next use, dense id), may hold outdated entries
+    int page_faults = 0;
+
+    for (int i = 0; i < len; ++i) {
+        int id = refs.ids[i];
+        if (resident_next[id] == -1) {
+            page_faults++;
+            if (resident_count == capacity) {
+                // Pop until the top entry still describes a resident page
+                while (true) {
+                    std::pop_heap(farthest.begin(), farthest.end());
+                    std::pair<int, int> top = farthest.back();
+                    farthest.pop_back();
+                    if (resident_next[top.second] == top.first) {
+                        resident_next[top.second] = -1;
+                        break;
+                    }
+                }
+            } else {
+                resident_count++;
+            }
+        }
+        resident_next[id] = refs.next_use[i];
+        farthest.emplace_back(refs.next_use[i], id);
+        std::push_heap(farthest.begin(), farthest.end());
+
+        if ((int)farthest.size() > 2 * resident_count + 16) {
+            // Drop outdated entries; exactly one live entry per resident page remains
+            farthest.erase(std::remove_if(farthest.begin(), farthest.end(),
+                                          [&](const std::pair<int, int>& e) { return resident_next[e.second] != e.first; }),
+                           farthest.end());
+            std::make_heap(farthest.begin(), farthest.end());
+        }
+    }
+    return page_faults;
+}
+
+int optimalPageReplacementFast(const std::vector<int>& pages, int capacity) {
+    if (capacity <= 0) return pages.size();
+    return optimalFaults(preparePageTrace(pages, true), capacity);
+}
+
+// FIFO on a prepared trace: resident flags plus a ring buffer of dense ids
+int fifoFaults(const PageTrace& refs, int capacity) {
+    int len = refs.ids.size();
+    if (capacity <= 0) return len;
+
+    int num_slots = std::min(capacity, refs.distinct);
+    std::vector<int> ring(num_slots);
+    std::vector<char> resident(refs.distinct, 0);
+    int oldest = 0, used = 0;
+    int page_faults = 0;
+
+    for (int id : refs.ids) {
+        if (resident[id]) continue;
+        page_faults++;
+        if (used == capacity) {
+            resident[ring[oldest]] = 0;
+            ring[oldest] = id;
+            if (++oldest == num_slots) oldest = 0;
+        } else {
+            ring[used++] = id;
+        }
+        resident[id] = 1;
+    }
+    return page_faults;
+}
+
+// --- Page Fault Curves ---
+// Each function returns faults[c - 1] = page faults with c frames, for c = 1..max_capacity.
+
+// LRU in a single pass using Mattson's stack distance: a reference hits with c frames
+// iff fewer than c distinct pages were touched since the previous reference to it.
+// A Fenwick tree over reference positions marks the latest reference of each page, so
+// the distinct-page count between two references is a prefix-sum query. O(len log len).
+std::vector<int> lruFaultCurve(const std::vector<int>& pages, int max_capacity) {
+    std::vector<int> faults(std::max(max_capacity, 0), 0);
+    if (max_capacity <= 0) return faults;
+
+    PageTrace refs = preparePageTrace(pages, false);
+    int len = refs.ids.size();
+    std::vector<int> fenwick(len + 1, 0);
+    auto add = [&](int pos, int delta) {
+        for (++pos; pos <= len; pos += pos & -pos) fenwick[pos] += delta;
+    };
+    auto prefix = [&](int pos) { // Sum over positions [0, pos)
+        int sum = 0;
+        for (; pos > 0; pos -= pos & -pos) sum += fenwick[pos];
+        return sum;
+    };
+
+    std::vector<int> last_ref(refs.distinct, -1);
+    std::vector<int> hits_at_distance(max_capacity + 1, 0); // Index = stack distance (1-based)
+    int live = 0; // Marked positions (= distinct pages seen so far)
+
+    for (int i = 0; i < len; ++i) {
+        int id = refs.ids[i];
+        int previous = last_ref[id];
+        if (previous != -1) {
+            // Distinct pages referenced after `previous`, plus this page itself
+            int distance = live - prefix(previous + 1) + 1;
+            if (distance <= max_capacity) hits_at_distance[distance]++;
+            add(previous, -1);
+        } else {
+            live++;
+        }
+        add(i, 1);
+        last_ref[id] = i;
+    }
+
+    // With c frames every reference with stack distance <= c is a hit
+    int hits = 0;
+    for (int c = 1; c <= max_capacity; ++c) {
+        hits += hits_at_distance[c];
+        faults[c - 1] = len - hits;
+    }
+    return faults;
+}
+
+// Runs run_one(capacity) for every capacity on a small pool of threads
+template <typename RunOne>
+std::vector<int> parallelFaultCurve(int max_capacity, int num_threads, RunOne run_one) {
+    std::vector<int> faults(std::max(max_capacity, 0), 0);
+    if (max_capacity <= 0) return faults;
+    if (num_threads <= 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, max_capacity);
+
+    std::atomic<int> next_capacity{1};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < num_threads; ++t) {
+        workers.emplace_back([&]() {
+            for (int c = next_capacity++; c <= max_capacity; c = next_capacity++) {
+                faults[c - 1] = run_one(c);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    return faults;
+}
+
+// FIFO is not a stack algorithm (Belady's anomaly), so each capacity is simulated separately
+std::vector<int> fifoFaultCurve(const std::vector<int>& pages, int max_capacity, int num_threads = 0) {
+    PageTrace refs = preparePageTrace(pages, false);
+    return parallelFaultCurve(max_capacity, num_threads, [&](int c) { return fifoFaults(refs, c); });
+}
+
+std::vector<int> optimalFaultCurve(const std::vector<int>& pages, int max_capacity, int num_threads = 0) {
+    PageTrace refs = preparePageTrace(pages, true);
+    return parallelFaultCurve(max_capacity, num_threads, [&](int c) { return optimalFaults(refs, c); });
+}
+
 int main() {
     // Example Page Reference String
     std::vector<int> page_references = {7, 0, 1, 2, 0, 3, 0, 4, 2, 3, 0, 3, 2, 1, 2, 0, 1, 7, 0, 1};
@@ -207,15 +439,38 @@ int main() {
     for(int p : page_references) std::cout << p << " ";
     std::cout << "\nNumber of Frames: " << frame_capacity << std::endl;
 
-    int fifo_faults = fifoPageReplacement(page_references, frame_capacity);
+    int fifo_faults = fifoPageReplacement(page_references, frame_capacity, true);
     std::cout << "Total Page Faults (FIFO): " << fifo_faults << std::endl;
 
-    int lru_faults = lruPageReplacement(page_references, frame_capacity);
+    int lru_faults = lruPageReplacement(page_references, frame_capacity, true);
     std::cout << "Total Page Faults (LRU): " << lru_faults << std::endl;
 
-    int optimal_faults = optimalPageReplacement(page_references, frame_capacity);
+    int optimal_faults = optimalPageReplacement(page_references, frame_capacity, true);
     std::cout << "Total Page Faults (Optimal): " << optimal_faults << std::endl;
 
+    int optimal_fast_faults = optimalPageReplacementFast(page_references, frame_capacity);
+    std::cout << "Total Page Faults (Optimal, next-use heap): " << optimal_fast_faults << std::endl;
+
+    // Fault curves for every frame count at once (no tracing). The second string
+    // shows Belady's anomaly: FIFO faults more with 4 frames than with 3.
+    const int max_frames = 7;
+    std::vector<std::vector<int>> curve_inputs = {
+        page_references,
+        {1, 2, 3, 4, 1, 2, 5, 1, 2, 3, 4, 5}
+    };
+    for (const auto& refs : curve_inputs) {
+        std::vector<int> fifo_curve = fifoFaultCurve(refs, max_frames);
+        std::vector<int> lru_curve = lruFaultCurve(refs, max_frames);
+        std::vector<int> optimal_curve = optimalFaultCurve(refs, max_frames);
+
+        std::cout << "\n--- Page Fault Curves (" << refs.size() << " references) ---" << std::endl;
+        std::cout << std::setw(8) << "Frames" << std::setw(8) << "FIFO"
+                  << std::setw(8) << "LRU" << std::setw(10) << "Optimal" << std::endl;
+        for (int c = 1; c <= max_frames; ++c) {
+            std::cout << std::setw(8) << c << std::setw(8) << fifo_curve[c - 1]
+                      << std::setw(8) << lru_curve[c - 1] << std::setw(10) << optimal_curve[c - 1] << std::endl;
+        }
+    }
 
     return 0;
 }
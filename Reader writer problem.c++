@@ -6,6 +6,11 @@
 #include <shared_mutex> // Requires C++17
 #include <chrono>       // For sleep
 #include <random>       // For random sleep times
+#include <atomic>
+#include <condition_variable>
+#include <string>
+#include <algorithm>    // For std::max
+#include <cstdlib>      // For std::atoi
 
 // Shared resource
 int shared_data = 0;
@@ -71,7 +76,324 @@ void writer(int id) {
     }
 }
 
-int main() {
+// ---------------------------------------------------------------------------
+// Benchmark mode (--bench): lock contention measurements
+// ---------------------------------------------------------------------------
+// Same reader/writer workload with no sleeps and no printing while holding a
+// lock. Each thread records how long it waited to get the lock (acquire latency)
+// and how long it held it, and the run compares several lock strategies across
+// thread counts. Output is CSV.
+// Seqlock readers take no lock, so for them "hold" is the read section that
+// validated, and "acquire" is everything before it: waiting out a writer plus any
+// read sections thrown away because a write overlapped them (counted in
+// read_retries).
+
+// Log2 histogram of nanosecond latencies: bucket b holds values in [2^(b-1), 2^b)
+struct LatencyHistogram {
+    static const int BUCKETS = 48;
+    long long counts[BUCKETS] = {};
+    long long total = 0;
+    long long sum_ns = 0;
+    long long max_ns = 0;
+
+    void record(long long ns) {
+        int b = 0;
+        while (b < BUCKETS - 1 && (1LL << b) <= ns) b++;
+        counts[b]++;
+        total++;
+        sum_ns += ns;
+        if (ns > max_ns) max_ns = ns;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (int b = 0; b < BUCKETS; ++b) counts[b] += other.counts[b];
+        total += other.total;
+        sum_ns += other.sum_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+    }
+
+    // Upper bound of the bucket containing quantile q (0..1)
+    long long percentile(double q) const {
+        if (total == 0) return 0;
+        long long target = (long long)(q * (total - 1)) + 1;
+        long long seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += counts[b];
+            if (seen >= target) return b == 0 ? 0 : (1LL << b);
+        }
+        return max_ns;
+    }
+
+    double mean() const { return total > 0 ? (double)sum_ns / total : 0; }
+};
+
+// Per-thread results, cache-line aligned so threads never share a line
+struct alignas(64) RwThreadStats {
+    LatencyHistogram acquire;
+    LatencyHistogram hold;
+    long long reads = 0;
+    long long writes = 0;
+    long long torn_reads = 0; // Reader saw a half-finished write (must stay 0)
+    long long read_retries = 0; // Seqlock read sections discarded after a concurrent write
+};
+
+// Benchmark copy of shared_data. Writers keep both fields equal, so a reader that
+// sees them differ observed a torn write. Atomics (relaxed) keep the seqlock's
+// optimistic reads free of data races; the locks provide the ordering.
+struct RwBenchData {
+    std::atomic<long long> value{0};
+    std::atomic<long long> mirror{0};
+};
+
+// Baseline: the std::shared_mutex used by the demo above
+struct SharedMutexLock {
+    static constexpr bool optimistic_reads = false;
+    static const char* name() { return "shared_mutex"; }
+    std::shared_mutex m;
+    explicit SharedMutexLock(int) {}
+    void read_lock(int) { m.lock_shared(); }
+    void read_unlock(int) { m.unlock_shared(); }
+    void write_lock() { m.lock(); }
+    void write_unlock() { m.unlock(); }
+};
+
+// Writers get priority: once a writer is waiting, new readers queue behind it
+struct WriterPreferringLock {
+    static constexpr bool optimistic_reads = false;
+    static const char* name() { return "writer_preferring"; }
+    std::mutex m;
+    std::condition_variable readers_cv;
+    std::condition_variable writers_cv;
+    int active_readers = 0;
+    int waiting_writers = 0;
+    bool writer_active = false;
+
+    explicit WriterPreferringLock(int) {}
+    void read_lock(int) {
+        std::unique_lock<std::mutex> lk(m);
+        readers_cv.wait(lk, [&] { return !writer_active && waiting_writers == 0; });
+        active_readers++;
+    }
+    void read_unlock(int) {
+        std::lock_guard<std::mutex> lk(m);
+        if (--active_readers == 0 && waiting_writers > 0) writers_cv.notify_one();
+    }
+    void write_lock() {
+        std::unique_lock<std::mutex> lk(m);
+        waiting_writers++;
+        writers_cv.wait(lk, [&] { return !writer_active && active_readers == 0; });
+        waiting_writers--;
+        writer_active = true;
+    }
+    void write_unlock() {
+        std::lock_guard<std::mutex> lk(m);
+        writer_active = false;
+        if (waiting_writers > 0) writers_cv.notify_one();
+        else readers_cv.notify_all();
+    }
+};
+
+// Striped reader lock: one shared_mutex per stripe (one stripe per hardware thread).
+// A reader only touches its own stripe, so readers on different cores don't bounce
+// a shared cache line; a writer must take every stripe, in index order.
+struct StripedLock {
+    static constexpr bool optimistic_reads = false;
+    static const char* name() { return "striped_readers"; }
+    struct alignas(64) Stripe { std::shared_mutex m; };
+    std::vector<Stripe> stripes;
+
+    explicit StripedLock(int) : stripes(std::max(1u, std::thread::hardware_concurrency())) {}
+    void read_lock(int tid) { stripes[tid % stripes.size()].m.lock_shared(); }
+    void read_unlock(int tid) { stripes[tid % stripes.size()].m.unlock_shared(); }
+    void write_lock() { for (auto& s : stripes) s.m.lock(); }
+    void write_unlock() { for (auto it = stripes.rbegin(); it != stripes.rend(); ++it) it->m.unlock(); }
+};
+
+// Seqlock: writers serialize on a mutex and bump a sequence counter around the
+// update (odd = write in progress). Readers take no lock; they read the data and
+// retry if the sequence changed underneath them.
+struct SeqLock {
+    static constexpr bool optimistic_reads = true;
+    static const char* name() { return "seqlock"; }
+    std::atomic<unsigned> seq{0};
+    std::mutex writer_mutex;
+
+    explicit SeqLock(int) {}
+    unsigned read_begin() {
+        unsigned s;
+        while ((s = seq.load(std::memory_order_acquire)) & 1u) std::this_thread::yield();
+        return s;
+    }
+    bool read_retry(unsigned start) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq.load(std::memory_order_relaxed) != start;
+    }
+    void write_lock() {
+        writer_mutex.lock();
+        seq.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    void write_unlock() {
+        seq.fetch_add(1, std::memory_order_release);
+        writer_mutex.unlock();
+    }
+};
+
+struct RwBenchOptions {
+    int max_threads = 256;
+    int duration_ms = 200;
+    int write_percent = 10;
+    int critical_work = 50;  // Spin iterations inside the critical section
+    bool per_thread = false;
+};
+
+// Stand-in for work done while holding the lock
+inline void spinWork(int iterations) {
+    for (int i = 0; i < iterations; ++i) {
+        std::atomic_signal_fence(std::memory_order_seq_cst); // Keeps the loop from being optimized away
+    }
+}
+
+template <typename Lock>
+void runRwStrategy(int num_threads, const RwBenchOptions& opt) {
+    using clock = std::chrono::steady_clock;
+    Lock lock(num_threads);
+    RwBenchData data;
+    std::vector<RwThreadStats> stats(num_threads);
+    std::atomic<bool> stop{false};
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+
+    auto worker = [&](int tid) {
+        RwThreadStats& st = stats[tid];
+        std::minstd_rand rng(tid * 7919 + 1);
+        ready++;
+        while (!go.load()) std::this_thread::yield(); // Start together, after the clock starts
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            bool is_write = (int)(rng() % 100) < opt.write_percent;
+            auto t0 = clock::now();
+            if (is_write) {
+                lock.write_lock();
+                auto t1 = clock::now();
+                long long v = data.value.load(std::memory_order_relaxed) + 1;
+                data.value.store(v, std::memory_order_relaxed);
+                spinWork(opt.critical_work);
+                data.mirror.store(v, std::memory_order_relaxed);
+                auto t2 = clock::now();
+                lock.write_unlock();
+                st.acquire.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+                st.hold.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+                st.writes++;
+            } else {
+                long long a, b;
+                clock::time_point t1, t2;
+                if constexpr (Lock::optimistic_reads) {
+                    // t1 marks the start of the attempt that validates
+                    for (;;) {
+                        unsigned s = lock.read_begin();
+                        t1 = clock::now();
+                        a = data.value.load(std::memory_order_relaxed);
+                        spinWork(opt.critical_work);
+                        b = data.mirror.load(std::memory_order_relaxed);
+                        if (!lock.read_retry(s)) break;
+                        st.read_retries++;
+                    }
+                    t2 = clock::now();
+                } else {
+                    lock.read_lock(tid);
+                    t1 = clock::now();
+                    a = data.value.load(std::memory_order_relaxed);
+                    spinWork(opt.critical_work);
+                    b = data.mirror.load(std::memory_order_relaxed);
+                    t2 = clock::now();
+                    lock.read_unlock(tid);
+                }
+                if (a != b) st.torn_reads++;
+                st.acquire.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+                st.hold.record(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+                st.reads++;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) threads.emplace_back(worker, t);
+    while (ready.load() < num_threads) std::this_thread::yield();
+    auto start = clock::now();
+    go = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(opt.duration_ms));
+    stop = true;
+    for (auto& th : threads) th.join();
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    auto printRow = [&](const std::string& thread_label, const RwThreadStats& s) {
+        long long ops = s.reads + s.writes;
+        std::cout << Lock::name() << ',' << num_threads << ',' << thread_label << ','
+                  << ops << ',' << (long long)(ops / seconds) << ','
+                  << s.reads << ',' << s.writes << ','
+                  << s.acquire.percentile(0.5) << ',' << s.acquire.percentile(0.99) << ','
+                  << s.acquire.max_ns << ',' << (long long)s.hold.mean() << ','
+                  << s.torn_reads << ',' << s.read_retries << '\n';
+    };
+
+    RwThreadStats total;
+    for (int t = 0; t < num_threads; ++t) {
+        total.acquire.merge(stats[t].acquire);
+        total.hold.merge(stats[t].hold);
+        total.reads += stats[t].reads;
+        total.writes += stats[t].writes;
+        total.torn_reads += stats[t].torn_reads;
+        total.read_retries += stats[t].read_retries;
+        if (opt.per_thread) printRow(std::to_string(t), stats[t]);
+    }
+    printRow("all", total);
+}
+
+int runRwBenchmark(int argc, char** argv) {
+    RwBenchOptions opt;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--per-thread") {
+            opt.per_thread = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return 1;
+        }
+        int value = std::atoi(argv[++i]);
+        if (arg == "--max-threads") opt.max_threads = value;
+        else if (arg == "--duration-ms") opt.duration_ms = value;
+        else if (arg == "--write-percent") opt.write_percent = value;
+        else if (arg == "--critical-work") opt.critical_work = value;
+        else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (opt.max_threads < 1 || opt.duration_ms < 1 || opt.write_percent < 0 || opt.write_percent > 100) {
+        std::cerr << "Usage: reader_writer --bench [--max-threads N (default 256)] [--duration-ms MS] "
+                  << "[--write-percent P] [--critical-work ITERS] [--per-thread]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "strategy,threads,thread,ops,ops_per_sec,reads,writes,"
+              << "acquire_p50_ns,acquire_p99_ns,acquire_max_ns,hold_avg_ns,torn_reads,read_retries\n";
+    for (int threads = 1; threads <= opt.max_threads; threads *= 2) {
+        runRwStrategy<SharedMutexLock>(threads, opt);
+        runRwStrategy<WriterPreferringLock>(threads, opt);
+        runRwStrategy<StripedLock>(threads, opt);
+        runRwStrategy<SeqLock>(threads, opt);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        return runRwBenchmark(argc, argv);
+    }
+
     std::cout << "--- Reader/Writer Problem (using std::shared_mutex) ---" << std::endl;
 
     const int NUM_READERS = 5;
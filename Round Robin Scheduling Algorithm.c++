@@ -1,8 +1,7 @@
 // round_robin.cpp
 #include <iostream>
 #include <vector>
-#include <queue>
-#include <numeric>   // For accumulate
+#include <numeric>   // For accumulate, iota
 #include <iomanip>   // For formatting output
 #include <algorithm> // For min
 
@@ -14,122 +13,171 @@ struct ProcessRR {
     int completion_time;
     int turnaround_time;
     int waiting_time;
-    bool in_queue; // To prevent adding the same process multiple times if it arrives while checked
+    bool in_queue; // Set while the process sits in the ready queue, so it is never queued twice
 
     ProcessRR(int id, int at, int bt) :
         pid(id), arrival_time(at), burst_time(bt), remaining_burst_time(bt),
         completion_time(0), turnaround_time(0), waiting_time(0), in_queue(false) {}
 };
 
-void roundRobinScheduling(std::vector<ProcessRR>& processes, int quantum) {
+// Result of one run in a quantum sweep
+struct RRQuantumResult {
+    int quantum;
+    double avg_waiting_time;
+    double avg_turnaround_time;
+    int context_switches; // Dispatches that switched to a different process
+    int makespan;         // Completion time of the last process
+};
+
+// Fixed-capacity FIFO of process indices. Callers only push a process whose
+// in_queue flag is clear, so each one is queued at most once and n slots are enough.
+struct RRReadyRing {
+    std::vector<int> slots;
+    int head = 0;
+    int count = 0;
+
+    void reset(int capacity) {
+        slots.resize(capacity);
+        head = 0;
+        count = 0;
+    }
+    bool empty() const { return count == 0; }
+    void push(int idx) {
+        int tail = head + count;
+        if (tail >= (int)slots.size()) tail -= slots.size();
+        slots[tail] = idx;
+        count++;
+    }
+    int pop() {
+        int idx = slots[head];
+        if (++head == (int)slots.size()) head = 0;
+        count--;
+        return idx;
+    }
+};
+
+// Core Round Robin engine. `arrival_order` holds process indices sorted by arrival_time;
+// a single cursor walks it to admit new arrivals, so the process list is never rescanned.
+// Arrivals during a slice are queued ahead of the preempted process. Resets all
+// per-process results, so it can be called repeatedly on the same vector.
+// Returns the number of context switches.
+int runRoundRobin(std::vector<ProcessRR>& processes, const std::vector<int>& arrival_order,
+                  int quantum, RRReadyRing& ready_queue, bool trace) {
     int n = processes.size();
-    if (n == 0) return;
+    if (n == 0) return 0;
+
+    for (auto& p : processes) {
+        p.remaining_burst_time = p.burst_time;
+        p.completion_time = p.turnaround_time = p.waiting_time = 0;
+        p.in_queue = false;
+    }
+    ready_queue.reset(n);
 
-    std::queue<int> ready_queue; // Stores indices of processes in the processes vector
     int current_time = 0;
     int completed_processes = 0;
-    int current_process_index = 0; // To track which process to check for arrival
+    int next_arrival = 0; // Cursor into arrival_order
+    int last_idx = -1;
+    int context_switches = 0;
 
-    std::cout << "\n--- Round Robin Scheduling (Quantum = " << quantum << ") ---" << std::endl;
-    std::cout << "Execution Trace (PID | Time):" << std::endl;
-
-    // Initial check for processes arriving at time 0
-    while(current_process_index < n && processes[current_process_index].arrival_time <= current_time) {
-        if (!processes[current_process_index].in_queue) {
-             ready_queue.push(current_process_index);
-             processes[current_process_index].in_queue = true;
+    auto admit_arrivals = [&]() {
+        while (next_arrival < n && processes[arrival_order[next_arrival]].arrival_time <= current_time) {
+            int idx = arrival_order[next_arrival++];
+            if (!processes[idx].in_queue) {
+                ready_queue.push(idx);
+                processes[idx].in_queue = true;
+            }
         }
-        current_process_index++;
-    }
+    };
+
+    admit_arrivals();
 
     while (completed_processes < n) {
         if (ready_queue.empty()) {
-            // If queue is empty, advance time to the next arrival
-            int next_arrival_time = -1;
-            for(int i = 0; i < n; ++i) {
-                if(processes[i].remaining_burst_time > 0 && !processes[i].in_queue) {
-                     if(next_arrival_time == -1 || processes[i].arrival_time < next_arrival_time) {
-                        next_arrival_time = processes[i].arrival_time;
-                     }
-                }
-            }
-             if (next_arrival_time != -1) {
-                 std::cout << "CPU Idle | " << current_time << " -> " << next_arrival_time << std::endl;
-                 current_time = next_arrival_time;
-             } else {
-                 // Should not happen if completed_processes < n, but as a safeguard
-                 break;
-             }
-
-            // Add processes that arrived by the new current_time
-             current_process_index = 0; // Reset check index
-             while(current_process_index < n) {
-                 if(processes[current_process_index].remaining_burst_time > 0 &&
-                    processes[current_process_index].arrival_time <= current_time &&
-                    !processes[current_process_index].in_queue)
-                 {
-                      ready_queue.push(current_process_index);
-                      processes[current_process_index].in_queue = true;
-                 }
-                 current_process_index++;
-             }
-
-             if (ready_queue.empty()) continue; // Still empty? Wait more.
+            // CPU idle: jump to the next arrival
+            int next_arrival_time = processes[arrival_order[next_arrival]].arrival_time;
+            if (trace) std::cout << "CPU Idle | " << current_time << " -> " << next_arrival_time << std::endl;
+            current_time = next_arrival_time;
+            admit_arrivals();
         }
 
-        int idx = ready_queue.front();
-        ready_queue.pop();
-        processes[idx].in_queue = false; // It's out of the queue now
+        int idx = ready_queue.pop();
+        processes[idx].in_queue = false;
+        if (idx != last_idx) context_switches++;
+        last_idx = idx;
 
         int time_slice = std::min(quantum, processes[idx].remaining_burst_time);
-
-        std::cout << "P" << processes[idx].pid << "       | " << current_time << " -> ";
+        if (trace) std::cout << "P" << processes[idx].pid << "       | " << current_time << " -> ";
 
         processes[idx].remaining_burst_time -= time_slice;
         current_time += time_slice;
-         std::cout << current_time << (processes[idx].remaining_burst_time == 0 ? " (Finished)" : "") << std::endl;
-
-
-        // Check for new arrivals during the execution of the current process
-        int check_arrival_idx = 0;
-         while(check_arrival_idx < n) {
-             if(processes[check_arrival_idx].remaining_burst_time > 0 && // Only if not finished
-                processes[check_arrival_idx].arrival_time <= current_time &&
-                !processes[check_arrival_idx].in_queue && // Only if not already in queue
-                check_arrival_idx != idx) // Don't add self if it was just processed
-                {
-                   // A simple check if it's already in the queue before adding
-                   bool already_in_queue = false;
-                   std::queue<int> temp_q = ready_queue;
-                   while(!temp_q.empty()){
-                       if(temp_q.front() == check_arrival_idx) {
-                           already_in_queue = true;
-                           break;
-                       }
-                       temp_q.pop();
-                   }
-                   if(!already_in_queue){
-                       ready_queue.push(check_arrival_idx);
-                       processes[check_arrival_idx].in_queue = true;
-                   }
-             }
-             check_arrival_idx++;
-         }
+        if (trace) std::cout << current_time << (processes[idx].remaining_burst_time == 0 ? " (Finished)" : "") << std::endl;
 
+        // New arrivals during the slice go in before the preempted process
+        admit_arrivals();
 
         if (processes[idx].remaining_burst_time == 0) {
-            // Process finished
             completed_processes++;
             processes[idx].completion_time = current_time;
             processes[idx].turnaround_time = processes[idx].completion_time - processes[idx].arrival_time;
             processes[idx].waiting_time = processes[idx].turnaround_time - processes[idx].burst_time;
-        } else {
-            // Process not finished, add back to the queue
-            // Check if it should be added back now or after new arrivals
+        } else if (!processes[idx].in_queue) {
             ready_queue.push(idx);
             processes[idx].in_queue = true;
         }
     }
+    return context_switches;
+}
+
+// Indices of `processes` sorted by arrival time (stable, so ties keep input order)
+std::vector<int> sortByArrival(const std::vector<ProcessRR>& processes) {
+    std::vector<int> order(processes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return processes[a].arrival_time < processes[b].arrival_time;
+    });
+    return order;
+}
+
+// Runs Round Robin once per quantum in `quanta` without printing. The arrival sort,
+// working copy and ready queue are set up once and shared by every run.
+std::vector<RRQuantumResult> roundRobinQuantumSweep(const std::vector<ProcessRR>& processes,
+                                                    const std::vector<int>& quanta) {
+    std::vector<RRQuantumResult> results;
+    int n = processes.size();
+    if (n == 0) return results;
+
+    std::vector<ProcessRR> work = processes;
+    std::vector<int> arrival_order = sortByArrival(work);
+    RRReadyRing ready_queue;
+    results.reserve(quanta.size());
+
+    for (int quantum : quanta) {
+        if (quantum <= 0) continue; // A non-positive quantum would never make progress
+        RRQuantumResult r{quantum, 0.0, 0.0, 0, 0};
+        r.context_switches = runRoundRobin(work, arrival_order, quantum, ready_queue, false);
+        double total_waiting_time = 0;
+        double total_turnaround_time = 0;
+        for (const auto& p : work) {
+            total_waiting_time += p.waiting_time;
+            total_turnaround_time += p.turnaround_time;
+            r.makespan = std::max(r.makespan, p.completion_time);
+        }
+        r.avg_waiting_time = total_waiting_time / n;
+        r.avg_turnaround_time = total_turnaround_time / n;
+        results.push_back(r);
+    }
+    return results;
+}
+
+void roundRobinScheduling(std::vector<ProcessRR>& processes, int quantum) {
+    int n = processes.size();
+    if (n == 0) return;
+
+    std::cout << "\n--- Round Robin Scheduling (Quantum = " << quantum << ") ---" << std::endl;
+    std::cout << "Execution Trace (PID | Time):" << std::endl;
+
+    RRReadyRing ready_queue;
+    runRoundRobin(processes, sortByArrival(processes), quantum, ready_queue, true);
 
      // --- Display Results ---
     std::cout << "\n--- Final Results ---" << std::endl;
@@ -168,6 +216,7 @@ void roundRobinScheduling(std::vector<ProcessRR>& processes, int quantum) {
 }
 
 
+#ifndef SCHEDULER_NO_MAIN // Define to reuse this file as a library (see Scheduling Policy Benchmark.c++)
 int main() {
     // Example Processes: (PID, Arrival Time, Burst Time)
     std::vector<ProcessRR> processes;
@@ -185,5 +234,23 @@ int main() {
     int time_quantum = 2;
     roundRobinScheduling(processes, time_quantum);
 
+    // Compare several quanta in one call (no trace output)
+    std::vector<int> quanta = {1, 2, 3, 4, 5};
+    std::cout << "\n--- Quantum Sweep ---" << std::endl;
+    std::cout << std::left << std::setw(10) << "Quantum"
+              << std::setw(17) << "Avg Waiting"
+              << std::setw(17) << "Avg Turnaround"
+              << std::setw(18) << "Context Switches"
+              << std::setw(10) << "Makespan" << std::endl;
+    std::cout << std::string(72, '-') << std::endl;
+    for (const auto& r : roundRobinQuantumSweep(processes, quanta)) {
+        std::cout << std::left << std::setw(10) << r.quantum
+                  << std::setw(17) << r.avg_waiting_time
+                  << std::setw(17) << r.avg_turnaround_time
+                  << std::setw(18) << r.context_switches
+                  << std::setw(10) << r.makespan << std::endl;
+    }
+
     return 0;
 }
+#endif
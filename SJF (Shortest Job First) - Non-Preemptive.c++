@@ -3,6 +3,7 @@
 #include <algorithm> // For std::sort, std::min_element
 #include <limits>    // For std::numeric_limits
 #include <iomanip>   // For formatting output
+#include <queue>     // For std::priority_queue
 
 // Structure to represent a process
 struct Process {
@@ -131,6 +132,62 @@ void calculateSJF_NonPreemptive(std::vector<Process>& processes) {
     }
 }
 
+// --- SJF (Non-Preemptive) Calculation, Heap-Based ---
+// Produces the same results as calculateSJF_NonPreemptive in O(n log n):
+// processes are sorted by arrival once, and those that have arrived move into a
+// min-heap ordered by (burstTime, arrivalTime, id). When nothing is ready the clock
+// jumps to the next unread arrival instead of rescanning every process.
+void calculateSJF_Heap(std::vector<Process>& processes) {
+    int n = processes.size();
+    if (n == 0) return;
+
+    // Sort indices, not the processes, so the caller's order is preserved for display
+    std::vector<int> arrivalOrder(n);
+    for (int i = 0; i < n; ++i) arrivalOrder[i] = i;
+    std::stable_sort(arrivalOrder.begin(), arrivalOrder.end(),
+                     [&](int a, int b){ return processes[a].arrivalTime < processes[b].arrivalTime; });
+
+    // "Greater than" comparator so the top of the priority_queue is the shortest job
+    auto longerJob = [&](int a, int b) {
+        const Process& pa = processes[a];
+        const Process& pb = processes[b];
+        if (pa.burstTime != pb.burstTime) return pa.burstTime > pb.burstTime;
+        if (pa.arrivalTime != pb.arrivalTime) return pa.arrivalTime > pb.arrivalTime;
+        return pa.id > pb.id;
+    };
+    std::vector<int> heapStorage;
+    heapStorage.reserve(n);
+    std::priority_queue<int, std::vector<int>, decltype(longerJob)> readyQueue(longerJob, std::move(heapStorage));
+
+    int currentTime = 0;
+    int nextArrival = 0; // Cursor into arrivalOrder
+
+    for (int completedProcesses = 0; completedProcesses < n; ++completedProcesses) {
+        if (readyQueue.empty() && processes[arrivalOrder[nextArrival]].arrivalTime > currentTime) {
+            // CPU is idle. Skip ahead to the next arrival.
+            currentTime = processes[arrivalOrder[nextArrival]].arrivalTime;
+        }
+
+        // Admit every process that has arrived by now
+        while (nextArrival < n && processes[arrivalOrder[nextArrival]].arrivalTime <= currentTime) {
+            readyQueue.push(arrivalOrder[nextArrival]);
+            nextArrival++;
+        }
+
+        Process& currentProcess = processes[readyQueue.top()];
+        readyQueue.pop();
+
+        currentProcess.completionTime = currentTime + currentProcess.burstTime;
+        currentProcess.turnaroundTime = currentProcess.completionTime - currentProcess.arrivalTime;
+        currentProcess.waitingTime = currentProcess.turnaroundTime - currentProcess.burstTime;
+         if (currentProcess.waitingTime < 0) currentProcess.waitingTime = 0; // Precaution
+
+        currentProcess.isCompleted = true;
+        currentTime = currentProcess.completionTime;
+    }
+}
+
+#ifndef SCHEDULER_NO_MAIN // Define to reuse this file as a library (see Scheduling Policy Benchmark.c++)
 int main() {
     int n;
     std::cout << "--- SJF (Non-Preemptive) Scheduling ---" << std::endl;
@@ -162,8 +219,9 @@ int main() {
         }
     }
 
-    calculateSJF_NonPreemptive(processes);
+    calculateSJF_Heap(processes);
     displayResults(processes);
 
     return 0;
 }
+#endif
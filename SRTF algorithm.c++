@@ -3,6 +3,7 @@
 #include <algorithm> // For std::sort, std::min_element
 #include <limits>    // For std::numeric_limits
 #include <iomanip>   // For formatting output
+#include <queue>     // For std::priority_queue
 
 // Structure to represent a process
 struct Process {
@@ -141,7 +142,95 @@ void calculateSRTF(std::vector<Process>& processes) {
     }
 }
 
+// --- SRTF (Preemptive SJF) Calculation, Event-Driven ---
+// Same schedule and metrics as calculateSRTF, but instead of stepping one time unit
+// at a time it jumps straight to the next event: either the running process finishes
+// or a new process arrives (the only moments a preemption can happen).
+// Ready processes live in a min-heap keyed on (remainingTime, arrivalTime, id), which
+// is exactly the tie-breaking order calculateSRTF uses. Runs in O(n log n).
+void calculateSRTF_EventDriven(std::vector<Process>& processes) {
+    int n = processes.size();
+    if (n == 0) return;
+
+    // Visit processes in arrival order without reordering the caller's vector
+    std::vector<int> arrivalOrder(n);
+    for (int i = 0; i < n; ++i) arrivalOrder[i] = i;
+    std::stable_sort(arrivalOrder.begin(), arrivalOrder.end(),
+                     [&](int a, int b){ return processes[a].arrivalTime < processes[b].arrivalTime; });
+
+    // Comparator is "greater than" so the priority_queue top is the shortest job.
+    // Only the popped (running) process ever has its remainingTime changed, so the
+    // keys of queued entries stay valid.
+    auto longerJob = [&](int a, int b) {
+        const Process& pa = processes[a];
+        const Process& pb = processes[b];
+        if (pa.remainingTime != pb.remainingTime) return pa.remainingTime > pb.remainingTime;
+        if (pa.arrivalTime != pb.arrivalTime) return pa.arrivalTime > pb.arrivalTime;
+        return pa.id > pb.id;
+    };
+    std::vector<int> heapStorage;
+    heapStorage.reserve(n);
+    std::priority_queue<int, std::vector<int>, decltype(longerJob)> readyQueue(longerJob, std::move(heapStorage));
+
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int nextArrival = 0; // Cursor into arrivalOrder
+
+    for (auto& p : processes) {
+        p.remainingTime = p.burstTime;
+        p.startTime = -1;
+        p.isCompleted = false;
+    }
+
+    while (completedProcesses < n) {
+        // Admit every process that has arrived by now
+        while (nextArrival < n && processes[arrivalOrder[nextArrival]].arrivalTime <= currentTime) {
+            readyQueue.push(arrivalOrder[nextArrival]);
+            nextArrival++;
+        }
+
+        if (readyQueue.empty()) {
+            // CPU is idle. Jump to the next arrival.
+            currentTime = processes[arrivalOrder[nextArrival]].arrivalTime;
+            continue;
+        }
+
+        int shortestJobIndex = readyQueue.top();
+        readyQueue.pop();
+        Process& currentProcess = processes[shortestJobIndex];
+
+        if (currentProcess.startTime == -1) {
+            currentProcess.startTime = currentTime;
+        }
+
+        // Run until completion or until the next arrival, whichever comes first.
+        // Between arrivals the running process only gets shorter, so it stays the minimum.
+        int runFor = currentProcess.remainingTime;
+        if (nextArrival < n) {
+            int untilArrival = processes[arrivalOrder[nextArrival]].arrivalTime - currentTime;
+            runFor = std::min(runFor, untilArrival);
+        }
+
+        currentProcess.remainingTime -= runFor;
+        currentTime += runFor;
+
+        if (currentProcess.remainingTime == 0) {
+            currentProcess.completionTime = currentTime;
+            currentProcess.turnaroundTime = currentProcess.completionTime - currentProcess.arrivalTime;
+            currentProcess.waitingTime = currentProcess.turnaroundTime - currentProcess.burstTime;
+             if (currentProcess.waitingTime < 0) currentProcess.waitingTime = 0; // Precaution
+
+            completedProcesses++;
+            currentProcess.isCompleted = true;
+        } else {
+            // Interrupted by an arrival; compete again with the newcomers
+            readyQueue.push(shortestJobIndex);
+        }
+    }
+}
+
 
+#ifndef SCHEDULER_NO_MAIN // Define to reuse this file as a library (see Scheduling Policy Benchmark.c++)
 int main() {
     int n;
     std::cout << "--- SRTF (Preemptive SJF) Scheduling ---" << std::endl;
@@ -175,8 +264,9 @@ int main() {
         processes[i].startTime = -1; // Initialize start time marker
     }
 
-    calculateSRTF(processes);
+    calculateSRTF_EventDriven(processes);
     displayResults(processes);
 
     return 0;
 }
+#endif
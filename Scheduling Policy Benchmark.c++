@@ -0,0 +1,419 @@
+// scheduling_benchmark.cpp
+// Runs the FCFS, SJF, SRTF and Round Robin implementations from this repository
+// side by side on synthetic workloads and prints one machine-readable row per run.
+// Every run executes in its own forked child, up to --threads at a time. The child
+// generates its workload, runs the algorithm, and sends its metrics back over a pipe.
+// peak_rss_kb is that child's own high-water mark (from wait4), so it covers one
+// workload plus one run and isn't affected by the other rows.
+//
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 "Scheduling Policy Benchmark.c++" -o scheduling_benchmark
+//
+// Usage:
+//   scheduling_benchmark [--max-exp 7] [--sizes 1000,50000] [--threads N] [--seed S]
+//                        [--quantum Q] [--load L] [--legacy-max N] [--format csv|json]
+
+// Standard headers used by the included scheduler files. They must come first so the
+// includes inside the namespaces below only pull in the scheduler code itself.
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <numeric>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <unistd.h>       // For fork, pipe
+#include <sys/wait.h>     // For wait4
+#include <sys/resource.h> // For struct rusage (per-child peak RSS)
+
+// Each scheduler file defines its own Process struct, so each gets its own namespace
+#define SCHEDULER_NO_MAIN
+namespace fcfs {
+#include "FCFS with Arrival Time.c++"
+}
+namespace sjf {
+#include "SJF (Shortest Job First) - Non-Preemptive.c++"
+}
+namespace srtf {
+#include "SRTF algorithm.c++"
+}
+namespace rr {
+#include "Round Robin Scheduling Algorithm.c++"
+}
+
+// Synthetic workload. Runs of the same size use the same seed, so every algorithm sees identical jobs
+struct Workload {
+    std::vector<int> arrival;
+    std::vector<int> burst;
+};
+
+const double PARETO_ALPHA = 1.5;   // Pareto shape: infinite variance, finite mean
+const double MIN_BURST = 1.0;
+const double MAX_BURST = 10000.0;
+
+// Mean of the bounded Pareto burst distribution (about 2.97 time units)
+double expectedMeanBurst() {
+    double a = PARETO_ALPHA;
+    return std::pow(MIN_BURST, a) / (1.0 - std::pow(MIN_BURST / MAX_BURST, a)) * (a / (a - 1.0))
+           * (1.0 / std::pow(MIN_BURST, a - 1.0) - 1.0 / std::pow(MAX_BURST, a - 1.0));
+}
+
+// Expected latest completion time for n jobs: the last arrival (n * mean / load)
+// plus, at worst, all of the work queued behind it
+double expectedHorizon(int n, double load) {
+    return n * expectedMeanBurst() * (1.0 + 1.0 / load);
+}
+
+// Poisson arrivals with heavy-tailed (bounded Pareto) bursts.
+// The arrival rate is chosen so the offered load on one CPU is `load`.
+// Returns false if the sampled timestamps could overflow int (the schedulers'
+// time type).
+bool generateWorkload(int n, double load, unsigned seed, Workload& w) {
+    const double ALPHA = PARETO_ALPHA;
+
+    w.arrival.resize(n);
+    w.burst.resize(n);
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<> unit(0.0, 1.0);
+
+    // Inverse-CDF sampling of the bounded Pareto distribution
+    double ratio = std::pow(MIN_BURST / MAX_BURST, ALPHA);
+    double totalBurst = 0;
+    for (int i = 0; i < n; ++i) {
+        double u = unit(gen);
+        double x = MIN_BURST / std::pow(1.0 - u * (1.0 - ratio), 1.0 / ALPHA);
+        w.burst[i] = std::max(1, (int)std::lround(x));
+        totalBurst += w.burst[i];
+    }
+
+    double meanInterArrival = (totalBurst / n) / load;
+    std::exponential_distribution<> interArrival(1.0 / meanInterArrival);
+    double clock = 0;
+    for (int i = 0; i < n; ++i) {
+        clock += interArrival(gen);
+        if (clock + totalBurst > std::numeric_limits<int>::max()) {
+            std::cerr << "Error: " << n << " jobs at load " << load
+                      << " produce timestamps beyond INT_MAX." << std::endl;
+            return false;
+        }
+        w.arrival[i] = (int)clock;
+    }
+    return true;
+}
+
+struct BenchmarkTask {
+    std::string algorithm;
+    int sizeIndex;
+};
+
+struct BenchmarkResult {
+    std::string algorithm;
+    int jobs = 0;
+    double wallMs = 0;
+    double jobsPerSec = 0;
+    long peakRssKb = 0;        // High-water mark of the child process that ran it
+    double avgWaitingTime = 0;
+    double avgTurnaroundTime = 0;
+};
+
+struct BenchmarkOptions {
+    std::vector<int> sizes;
+    int threads = 0;           // Concurrent child processes; 0 = one per hardware thread
+    unsigned seed = 12345;
+    int quantum = 4;
+    double load = 0.9;
+    int legacyMax = 10000;     // Largest size for the quadratic reference implementations
+    bool json = false;
+};
+
+// Copies the workload into the algorithm's own Process type, times only the
+// scheduling call, and averages the per-process metrics.
+template <typename P, typename MakeProcess, typename Schedule, typename WT, typename TAT>
+BenchmarkResult timeRun(const Workload& w, MakeProcess make, Schedule schedule, WT waiting, TAT turnaround) {
+    int n = w.arrival.size();
+    std::vector<P> processes;
+    processes.reserve(n);
+    for (int i = 0; i < n; ++i) processes.push_back(make(i + 1, w.arrival[i], w.burst[i]));
+
+    auto start = std::chrono::steady_clock::now();
+    schedule(processes);
+    auto end = std::chrono::steady_clock::now();
+
+    BenchmarkResult r;
+    r.jobs = n;
+    r.wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+    r.jobsPerSec = r.wallMs > 0 ? n / (r.wallMs / 1000.0) : 0;
+    double totalWT = 0;
+    double totalTAT = 0;
+    for (const auto& p : processes) {
+        totalWT += waiting(p);
+        totalTAT += turnaround(p);
+    }
+    r.avgWaitingTime = n > 0 ? totalWT / n : 0;
+    r.avgTurnaroundTime = n > 0 ? totalTAT / n : 0;
+    return r;
+}
+
+BenchmarkResult runAlgorithm(const std::string& algorithm, const Workload& w, const BenchmarkOptions& opt) {
+    BenchmarkResult r;
+    if (algorithm == "fcfs") {
+        r = timeRun<fcfs::ProcessWithArrival>(w,
+            [](int id, int at, int bt) { return fcfs::ProcessWithArrival{id, at, bt, 0, 0, 0, 0}; },
+            [](std::vector<fcfs::ProcessWithArrival>& p) { fcfs::calculateFcfsWithArrival(p); },
+            [](const fcfs::ProcessWithArrival& p) { return p.waitingTime; },
+            [](const fcfs::ProcessWithArrival& p) { return p.turnaroundTime; });
+    } else if (algorithm == "sjf" || algorithm == "sjf_scan") {
+        bool legacy = algorithm == "sjf_scan";
+        r = timeRun<sjf::Process>(w,
+            [](int id, int at, int bt) { return sjf::Process(id, at, bt); },
+            [legacy](std::vector<sjf::Process>& p) {
+                if (legacy) sjf::calculateSJF_NonPreemptive(p);
+                else sjf::calculateSJF_Heap(p);
+            },
+            [](const sjf::Process& p) { return p.waitingTime; },
+            [](const sjf::Process& p) { return p.turnaroundTime; });
+    } else if (algorithm == "srtf" || algorithm == "srtf_tick") {
+        bool legacy = algorithm == "srtf_tick";
+        r = timeRun<srtf::Process>(w,
+            [](int id, int at, int bt) { return srtf::Process(id, at, bt); },
+            [legacy](std::vector<srtf::Process>& p) {
+                if (legacy) srtf::calculateSRTF(p);
+                else srtf::calculateSRTF_EventDriven(p);
+            },
+            [](const srtf::Process& p) { return p.waitingTime; },
+            [](const srtf::Process& p) { return p.turnaroundTime; });
+    } else if (algorithm == "rr") {
+        int quantum = opt.quantum;
+        r = timeRun<rr::ProcessRR>(w,
+            [](int id, int at, int bt) { return rr::ProcessRR(id, at, bt); },
+            [quantum](std::vector<rr::ProcessRR>& p) {
+                rr::RRReadyRing ready_queue;
+                rr::runRoundRobin(p, rr::sortByArrival(p), quantum, ready_queue, false);
+            },
+            [](const rr::ProcessRR& p) { return p.waiting_time; },
+            [](const rr::ProcessRR& p) { return p.turnaround_time; });
+    }
+    r.algorithm = algorithm;
+    return r;
+}
+
+// Metrics a child sends back to the parent over its pipe
+struct ChildReport {
+    int jobs;
+    double wallMs;
+    double jobsPerSec;
+    double avgWaitingTime;
+    double avgTurnaroundTime;
+};
+
+struct RunningTask {
+    pid_t pid;
+    int readFd;
+    size_t taskIndex;
+};
+
+// Forks a child that generates the task's workload, runs it, writes a ChildReport
+// to a pipe and exits. Returns false if the pipe or fork fails.
+bool startTask(const BenchmarkTask& task, size_t taskIndex, const BenchmarkOptions& opt, RunningTask& child) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        std::cerr << "Error: pipe failed." << std::endl;
+        return false;
+    }
+    std::cout.flush(); // Nothing buffered may be written twice
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::cerr << "Error: fork failed." << std::endl;
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        Workload w;
+        if (!generateWorkload(opt.sizes[task.sizeIndex], opt.load, opt.seed + (unsigned)task.sizeIndex, w)) _exit(1);
+        BenchmarkResult r = runAlgorithm(task.algorithm, w, opt);
+        ChildReport report{r.jobs, r.wallMs, r.jobsPerSec, r.avgWaitingTime, r.avgTurnaroundTime};
+        bool ok = write(fds[1], &report, sizeof(report)) == (ssize_t)sizeof(report);
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    child = {pid, fds[0], taskIndex};
+    return true;
+}
+
+// Collects a reaped child's report and its peak RSS. Returns false if the child failed.
+bool finishTask(const RunningTask& child, int status, const struct rusage& usage,
+                const BenchmarkTask& task, BenchmarkResult& result) {
+    ChildReport report;
+    bool ok = read(child.readFd, &report, sizeof(report)) == (ssize_t)sizeof(report);
+    close(child.readFd);
+    if (!ok || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "Error: " << task.algorithm << " run on size index " << task.sizeIndex
+                  << " did not complete." << std::endl;
+        return false;
+    }
+    result.algorithm = task.algorithm;
+    result.jobs = report.jobs;
+    result.wallMs = report.wallMs;
+    result.jobsPerSec = report.jobsPerSec;
+    result.avgWaitingTime = report.avgWaitingTime;
+    result.avgTurnaroundTime = report.avgTurnaroundTime;
+    result.peakRssKb = usage.ru_maxrss; // Kilobytes on Linux
+    return true;
+}
+
+// Parses "1000,20000" into a list of positive sizes. Returns false on bad input.
+bool parseSizes(const std::string& text, std::vector<int>& sizes) {
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        long value = std::strtol(item.c_str(), nullptr, 10);
+        if (value <= 0 || value > std::numeric_limits<int>::max()) return false;
+        sizes.push_back((int)value);
+    }
+    return !sizes.empty();
+}
+
+void printUsage() {
+    std::cerr << "Usage: scheduling_benchmark [--max-exp E] [--sizes N1,N2,...] [--threads T]\n"
+              << "                            [--seed S] [--quantum Q] [--load L]\n"
+              << "                            [--legacy-max N] [--format csv|json]\n"
+              << "  --max-exp E     run sizes 10^3 .. 10^E (default 6, at most 7)\n"
+              << "  --legacy-max N  also run sjf_scan/srtf_tick up to N jobs (default 10000, 0 = off)\n";
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions opt;
+    int maxExp = 6;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--max-exp") maxExp = std::atoi(value.c_str());
+        else if (arg == "--sizes") {
+            if (!parseSizes(value, opt.sizes)) {
+                std::cerr << "Error: Invalid --sizes list." << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--threads") opt.threads = std::atoi(value.c_str());
+        else if (arg == "--seed") opt.seed = (unsigned)std::strtoul(value.c_str(), nullptr, 10);
+        else if (arg == "--quantum") opt.quantum = std::atoi(value.c_str());
+        else if (arg == "--load") opt.load = std::atof(value.c_str());
+        else if (arg == "--legacy-max") opt.legacyMax = std::atoi(value.c_str());
+        else if (arg == "--format") opt.json = (value == "json");
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (opt.sizes.empty()) {
+        if (maxExp < 3 || maxExp > 7) {
+            std::cerr << "Error: --max-exp must be between 3 and 7." << std::endl;
+            return 1;
+        }
+        for (int e = 3, size = 1000; e <= maxExp; ++e, size *= 10) opt.sizes.push_back(size);
+    }
+    if (opt.quantum <= 0 || opt.load <= 0) {
+        std::cerr << "Error: Quantum and load must be positive." << std::endl;
+        return 1;
+    }
+    for (int size : opt.sizes) {
+        if (expectedHorizon(size, opt.load) > std::numeric_limits<int>::max()) {
+            std::cerr << "Error: " << size << " jobs at load " << opt.load
+                      << " would run past INT_MAX time units; raise --load or use fewer jobs." << std::endl;
+            return 1;
+        }
+    }
+    if (opt.threads <= 0) opt.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<BenchmarkTask> tasks;
+    for (size_t s = 0; s < opt.sizes.size(); ++s) {
+        for (const char* algorithm : {"fcfs", "sjf", "srtf", "rr"}) tasks.push_back({algorithm, (int)s});
+        if (opt.sizes[s] <= opt.legacyMax) {
+            tasks.push_back({"sjf_scan", (int)s});
+            tasks.push_back({"srtf_tick", (int)s});
+        }
+    }
+    // Largest runs first so the pool doesn't end on one long straggler
+    std::stable_sort(tasks.begin(), tasks.end(), [&](const BenchmarkTask& a, const BenchmarkTask& b) {
+        return opt.sizes[a.sizeIndex] > opt.sizes[b.sizeIndex];
+    });
+
+    // Process pool: keep up to numThreads children running, start the next task
+    // whenever one is reaped
+    std::vector<BenchmarkResult> results(tasks.size());
+    std::vector<RunningTask> running;
+    int numThreads = std::min<int>(opt.threads, tasks.size());
+    size_t nextTask = 0;
+    bool failed = false;
+    while (nextTask < tasks.size() || !running.empty()) {
+        if (!failed && nextTask < tasks.size() && (int)running.size() < numThreads) {
+            RunningTask child;
+            if (!startTask(tasks[nextTask], nextTask, opt, child)) {
+                failed = true;
+                continue;
+            }
+            running.push_back(child);
+            nextTask++;
+            continue;
+        }
+        if (running.empty()) break; // Only reached after a failed fork
+
+        struct rusage usage;
+        int status = 0;
+        pid_t pid = wait4(-1, &status, 0, &usage);
+        if (pid < 0) {
+            std::cerr << "Error: wait4 failed." << std::endl;
+            return 1;
+        }
+        auto it = std::find_if(running.begin(), running.end(),
+                               [pid](const RunningTask& c) { return c.pid == pid; });
+        if (it == running.end()) continue;
+        if (!finishTask(*it, status, usage, tasks[it->taskIndex], results[it->taskIndex])) failed = true;
+        running.erase(it);
+    }
+    if (failed) return 1;
+
+    // Stable report order: by size, then algorithm
+    std::vector<size_t> order(results.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (results[a].jobs != results[b].jobs) return results[a].jobs < results[b].jobs;
+        return results[a].algorithm < results[b].algorithm;
+    });
+
+    std::cout << std::fixed << std::setprecision(3);
+    if (!opt.json) {
+        std::cout << "algorithm,jobs,threads,wall_ms,jobs_per_sec,peak_rss_kb,avg_waiting_time,avg_turnaround_time\n";
+    }
+    for (size_t i : order) {
+        const BenchmarkResult& r = results[i];
+        if (opt.json) {
+            std::cout << "{\"algorithm\":\"" << r.algorithm << "\",\"jobs\":" << r.jobs
+                      << ",\"threads\":" << numThreads
+                      << ",\"wall_ms\":" << r.wallMs << ",\"jobs_per_sec\":" << r.jobsPerSec
+                      << ",\"peak_rss_kb\":" << r.peakRssKb
+                      << ",\"avg_waiting_time\":" << r.avgWaitingTime
+                      << ",\"avg_turnaround_time\":" << r.avgTurnaroundTime << "}\n";
+        } else {
+            std::cout << r.algorithm << ',' << r.jobs << ',' << numThreads << ',' << r.wallMs << ','
+                      << r.jobsPerSec << ',' << r.peakRssKb << ','
+                      << r.avgWaitingTime << ',' << r.avgTurnaroundTime << '\n';
+        }
+    }
+    return 0;
+}